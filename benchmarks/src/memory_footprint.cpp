@@ -0,0 +1,127 @@
+#include <ghost/solver.hpp>
+#include <ghost/global_constraints/all_different.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace std::literals::chrono_literals;
+
+// Memory footprint of GHOST: peak resident set size of a Solver::solve call against the size of
+// the model and the number of threads, next to the estimation given by Solver::memory_usage.
+// Each configuration is run in its own process, so that peak resident set sizes do not add up.
+//
+// Usage: benchmark_memory_footprint [max_number_variables] [max_number_threads]
+
+// Latin squares of order 10: each block of 10 variables and each column of 10 consecutive
+// blocks must take different values.
+class LatinSquaresBuilder : public ghost::ModelBuilder
+{
+	int _number_squares;
+
+public:
+	LatinSquaresBuilder( int number_squares )
+		: ModelBuilder(),
+		  _number_squares( number_squares )
+	{ }
+
+	void declare_variables() override
+	{
+		create_n_variables( 100 * _number_squares, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		for( int square = 0 ; square < _number_squares ; ++square )
+			for( int line = 0 ; line < 10 ; ++line )
+			{
+				std::vector<int> row;
+				std::vector<int> column;
+				for( int i = 0 ; i < 10 ; ++i )
+				{
+					row.push_back( 100 * square + 10 * line + i );
+					column.push_back( 100 * square + 10 * i + line );
+				}
+
+				constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( row ) );
+				constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( column ) );
+			}
+	}
+};
+
+// Peak resident set size of the current process, in kilobytes
+long peak_rss()
+{
+	struct rusage usage;
+	getrusage( RUSAGE_SELF, &usage );
+#if defined __APPLE__
+	return usage.ru_maxrss / 1024;
+#else
+	return usage.ru_maxrss;
+#endif
+}
+
+void run( int number_variables, int number_threads )
+{
+	long rss_before = peak_rss();
+
+	LatinSquaresBuilder builder( number_variables / 100 );
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	options.parallel_runs = number_threads > 1;
+	options.number_threads = number_threads;
+
+	double cost;
+	std::vector<int> solution;
+	solver.solve( cost, solution, 200ms, options );
+	long rss_after = peak_rss();
+
+	// Solver::solve builds one search unit per thread
+	auto usage = solver.memory_usage();
+	std::size_t estimation = 0;
+	for( const auto& [ structure, bytes ] : usage.get_breakdown() )
+		estimation += structure.rfind( "search unit", 0 ) == 0 ? number_threads * bytes : bytes;
+
+	std::printf( "%10d %8d %14ld %14ld %20zu\n",
+	             number_variables,
+	             number_threads,
+	             rss_after,
+	             rss_after - rss_before,
+	             estimation / 1024 );
+}
+
+int main( int argc, char** argv )
+{
+	int max_number_variables = argc > 1 ? std::stoi( argv[1] ) : 10000;
+	int max_number_threads = argc > 2 ? std::stoi( argv[2] ) : 8;
+
+	std::printf( "%10s %8s %14s %14s %20s\n", "variables", "threads", "peak RSS (kB)", "solve (kB)", "estimation (kB)" );
+	for( int number_variables = 100 ; number_variables <= max_number_variables ; number_variables *= 10 )
+		for( int number_threads = 1 ; number_threads <= max_number_threads ; number_threads *= 2 )
+		{
+			std::fflush( stdout );
+			pid_t pid = fork();
+			if( pid == 0 )
+			{
+				run( number_variables, number_threads );
+				std::fflush( stdout );
+				_exit( 0 );
+			}
+
+			int status;
+			waitpid( pid, &status, 0 );
+		}
+
+	LatinSquaresBuilder builder( max_number_variables / 100 );
+	ghost::Solver solver( builder );
+	std::cout << "\nEstimated memory usage for " << max_number_variables << " variables:\n" << solver.memory_usage();
+
+	return EXIT_SUCCESS;
+}
@@ -39,10 +39,16 @@ namespace ghost
 	{
 		class AdaptiveSearchVariableCandidatesHeuristic : public VariableCandidatesHeuristic
 		{
+		protected:
+			AdaptiveSearchVariableCandidatesHeuristic( std::string&& name );
+
+			// Extra condition for a variable to be a candidate, on top of not being tabu. Always true here.
+			virtual bool is_eligible( const SearchUnitData& data, int variable_id ) const;
+
 		public:
 			AdaptiveSearchVariableCandidatesHeuristic();
 			
-			std::vector<double> compute_variable_candidates( const SearchUnitData& data ) const override;
+			void compute_variable_candidates( const SearchUnitData& data, VariableCandidates& candidates ) const override;
 		};
 	}
 }
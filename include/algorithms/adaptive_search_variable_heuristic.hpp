@@ -42,7 +42,7 @@ namespace ghost
 		public:
 			AdaptiveSearchVariableHeuristic();
 			
-			int select_variable_candidate( const std::vector<double>& candidates, const SearchUnitData& data, randutils::mt19937_rng& rng ) const override;
+			int select_variable_candidate( const VariableCandidates& candidates, const SearchUnitData& data, randutils::mt19937_rng& rng ) const override;
 		};
 	}
 }
@@ -42,7 +42,7 @@ namespace ghost
 		public:
 			AntidoteSearchVariableCandidatesHeuristic();
 			
-			std::vector<double> compute_variable_candidates( const SearchUnitData& data ) const override;
+			void compute_variable_candidates( const SearchUnitData& data, VariableCandidates& candidates ) const override;
 		};
 	}
 }
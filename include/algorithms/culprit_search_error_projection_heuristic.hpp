@@ -48,6 +48,8 @@ namespace ghost
 
 			void initialize_data_structures() override;
 
+			std::size_t memory_usage() const override;
+
 			void compute_variable_errors( std::vector<double>& error_variables,
 			                              const std::vector<Variable>& variables,
 			                              const std::vector<std::vector<int>>& matrix_var_ctr,
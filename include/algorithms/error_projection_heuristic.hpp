@@ -60,6 +60,9 @@ namespace ghost
 
 			virtual void initialize_data_structures() {};
 
+			// Memory taken by inner data structures, in bytes
+			virtual std::size_t memory_usage() const { return 0; }
+
 			virtual void compute_variable_errors( std::vector<double>& error_variables,
 			                                      const std::vector<Variable>& variables,
 			                                      const std::vector<std::vector<int>>& matrix_var_ctr,
@@ -0,0 +1,138 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <chrono>
+
+#include "../variable.hpp"
+#include "../model.hpp"
+
+namespace ghost
+{
+	namespace algorithms
+	{
+		/*!
+		 * ExhaustiveSearch enumerates all variable assignments of a model with a tiny search space
+		 * (see Options::exhaustive_search_threshold) and keeps the best one, which is then provably
+		 * optimal if the whole search space has been enumerated.
+		 *
+		 * Assignments are ranked from 0 to the size of the search space minus 1: for regular problems,
+		 * the rank of an assignment is a number in a mixed radix whose digits are the indexes of values
+		 * in the domain of each variable, the last variable being the least significant digit. For
+		 * permutation problems, it is the lexicographic rank of the permutation of the initial values
+		 * of variables. Each search enumerates an interval of ranks, so that several threads can share
+		 * the search space.
+		 *
+		 * Constraint errors are only defined on complete assignments, so no parts of the search space
+		 * can be pruned: going from an assignment to the next one only recomputes the error of constraints
+		 * with a changed variable, and the objective function on solutions.
+		 */
+		class ExhaustiveSearch final
+		{
+			Model _model;
+			std::vector<std::vector<int>> _variable_constraints; // _variable_constraints[v]: IDs of constraints containing the variable v
+			std::vector<std::vector<int>> _domains; // Domain of each variable
+			std::vector<int> _permutation_values; // Permutation problems: sorted initial values of variables
+			std::vector<int> _digits; // Digits of the current rank: index of the value of each variable in its domain, or in _permutation_values
+			std::vector<bool> _changed_constraints;
+			bool _is_optimization;
+			double _target_cost; // Target cost to minimize, NaN if none
+
+			std::vector<int> _best_values;
+			double _best_sat_error;
+			double _best_opt_cost;
+			long long _enumerated_assignments;
+			bool _exhausted;
+
+			// Set digits of the given rank.
+			void set_rank( long long rank );
+
+			// Set digits of the next rank.
+			void next_rank();
+
+			// Assign values given by digits to variables, and update the error of constraints with a changed variable.
+			void assign_values();
+
+			// Evaluate the current assignment. Return true iff the search can stop, i.e.,
+			// if it is a solution of a satisfaction problem or reaches the target cost.
+			bool evaluate();
+
+		public:
+			/*!
+			 * Unique constructor.
+			 * \param model the model to enumerate the search space of.
+			 * \param target_cost the objective function value below which (or above which for maximization
+			 * problems) a solution is good enough, NaN if none (see Options::target_cost).
+			 */
+			ExhaustiveSearch( Model&& model, double target_cost );
+
+			/*!
+			 * Size of the search space of a model: the product of domain sizes, or the number of
+			 * permutations of variables for permutation problems.
+			 * \param variables a const reference to the vector of variables of the model.
+			 * \param permutation_problem a Boolean indicating if the model is a permutation problem.
+			 * \param bound a bound on sizes of interest.
+			 * \return The size of the search space, or bound + 1 if it is larger than bound.
+			 */
+			static long long search_space_size( const std::vector<Variable>& variables, bool permutation_problem, long long bound );
+
+			/*!
+			 * Enumerate assignments of ranks in [first_rank, end_rank), until all of them are enumerated,
+			 * the deadline is reached or the stop flag is raised. The flag is raised when a solution of a
+			 * satisfaction problem is found, or when a solution reaches the target cost.
+			 * \param first_rank the rank of the first assignment to enumerate.
+			 * \param end_rank the rank following the last assignment to enumerate.
+			 * \param deadline the time point when the search must stop.
+			 * \param stop a reference to a flag shared by all searches enumerating the same search space.
+			 */
+			void search( long long first_rank,
+			             long long end_rank,
+			             std::chrono::time_point<std::chrono::steady_clock> deadline,
+			             std::atomic<bool>& stop );
+
+			//! Satisfaction error of the best assignment enumerated.
+			inline double get_best_sat_error() const { return _best_sat_error; }
+
+			//! Optimization cost of the best solution enumerated, to minimize.
+			inline double get_best_opt_cost() const { return _best_opt_cost; }
+
+			//! Number of assignments enumerated.
+			inline long long get_enumerated_assignments() const { return _enumerated_assignments; }
+
+			//! True iff all assignments of the interval given to ExhaustiveSearch::search have been enumerated.
+			inline bool is_exhausted() const { return _exhausted; }
+
+			//! Assign the best assignment enumerated to variables, and move out the model.
+			Model&& transfer_model();
+		};
+	}
+}
@@ -0,0 +1,97 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <chrono>
+
+#include "../variable.hpp"
+#include "../model.hpp"
+
+namespace ghost
+{
+	namespace algorithms
+	{
+		/*!
+		 * Intensification runs the final intensification phase of the solver (see
+		 * Options::intensification_percent_budget): a strict descent from a solution, exploring
+		 * exhaustively the neighborhood changing the value of one variable (except for permutation
+		 * problems) and the neighborhood swapping the values of two variables.
+		 *
+		 * A move is taken as soon as it leads to a solution with a strictly better objective function
+		 * value, and the descent stops on a local optimum for both neighborhoods or at the deadline.
+		 * Moves only recompute the error of constraints with a changed variable, and the objective
+		 * function if these constraints are still satisfied.
+		 */
+		class Intensification final
+		{
+			Model _model;
+			std::vector<std::vector<int>> _variable_constraints; // _variable_constraints[v]: IDs of constraints containing the variable v
+			std::vector<int> _constraint_marks; // Last move each constraint has been marked by, to list constraints of a move once
+			std::vector<int> _move_constraints;
+			double _opt_cost;
+			int _evaluated_moves;
+			int _improvements;
+			bool _local_optimum;
+
+			// Do the move assigning values to variables if it leads to a solution with a strictly
+			// better objective function value, undo it otherwise. Return true iff the move is done.
+			bool try_move( const std::vector<int>& variables, const std::vector<int>& values );
+
+			void assign( const std::vector<int>& variables, const std::vector<int>& values );
+
+		public:
+			/*!
+			 * Unique constructor.
+			 * \param model the model to intensify the search on.
+			 * \param solution the values of a solution of the model to start the descent from.
+			 */
+			Intensification( Model&& model, const std::vector<int>& solution );
+
+			/*!
+			 * Descend from the solution given to the constructor until reaching a local optimum or the deadline.
+			 * \param deadline the time point when the descent must stop.
+			 */
+			void search( std::chrono::time_point<std::chrono::steady_clock> deadline );
+
+			//! Optimization cost of the current solution, to minimize.
+			inline double get_opt_cost() const { return _opt_cost; }
+
+			//! Number of moves done by the descent.
+			inline int get_improvements() const { return _improvements; }
+
+			//! True iff the descent has reached a local optimum before the deadline.
+			inline bool is_local_optimum() const { return _local_optimum; }
+
+			//! Move out the model, whose variables take the values of the current solution.
+			inline Model&& transfer_model() { return std::move( _model ); }
+		};
+	}
+}
@@ -0,0 +1,148 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+#include "../objective.hpp"
+#include "../model.hpp"
+#include "../thirdparty/randutils.hpp"
+
+namespace ghost
+{
+	namespace algorithms
+	{
+		/*
+		 * ProjectedConstraint evaluates a constraint on a coarse model when the constraint does not
+		 * override Constraint::optional_coarsen: the values of coarse variables are projected on copies
+		 * of the variables of the finer constraint, then the error of the finer constraint is computed.
+		 */
+		class ProjectedConstraint : public Constraint
+		{
+			std::shared_ptr<Constraint> _constraint; // Constraint of the finer model
+			std::vector<int> _projection; // _projection[i]: index in this constraint's scope of the variable merging the i-th variable of _constraint
+			mutable std::vector<Variable> _finer_variables; // Copies of the variables of _constraint
+			std::vector<Variable*> _finer_variables_pointers;
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+		public:
+			ProjectedConstraint( const std::vector<int>& variables_index,
+			                     const std::shared_ptr<Constraint>& constraint,
+			                     const std::vector<int>& projection );
+
+			// _finer_variables_pointers must point to the variables of the object itself.
+			ProjectedConstraint( const ProjectedConstraint& other ) = delete;
+		};
+
+		/*
+		 * ProjectedObjective does the same as ProjectedConstraint for the objective function.
+		 */
+		class ProjectedObjective : public Objective
+		{
+			std::shared_ptr<Objective> _objective; // Objective function of the finer model
+			std::vector<int> _projection; // _projection[i]: index in this objective's scope of the variable merging the i-th variable of _objective
+			mutable std::vector<Variable> _finer_variables; // Copies of the variables of _objective
+			std::vector<Variable*> _finer_variables_pointers;
+
+			double required_cost( const std::vector<Variable*>& variables ) const override;
+
+		public:
+			ProjectedObjective( const std::vector<int>& variables_index,
+			                    const std::shared_ptr<Objective>& objective,
+			                    const std::vector<int>& projection );
+
+			// _finer_variables_pointers must point to the variables of the object itself.
+			ProjectedObjective( const ProjectedObjective& other ) = delete;
+		};
+
+		/*!
+		 * Multilevel builds the coarse models of the multilevel mode of the solver (see Options::multilevel).
+		 *
+		 * Level 0 is the model given to the constructor. The model of level l+1 is obtained by
+		 * merging pairs of variables of level l into one variable, taking the same value for
+		 * both. Pairs are found by heavy-edge matching: variables are visited in random order,
+		 * and each unmatched variable is merged with the unmatched variable sharing the most
+		 * constraints with it. Constraints with a small scope weight more, and constraints with
+		 * more than 32 variables are ignored. Only variables with the same domain that all their
+		 * common constraints allow to merge (see Constraint::optional_can_merge) can be merged.
+		 *
+		 * Constraints of coarse models are built by Constraint::optional_coarsen, or projected
+		 * otherwise. Coarsening stops when the model has at most coarsest_size variables, or when
+		 * a level does not decrease the number of variables by at least 10%.
+		 *
+		 * The solver solves the coarsest model first, then uses its solution projected on the
+		 * previous level as a starting point, and so on until level 0.
+		 */
+		class Multilevel final
+		{
+			std::vector<Model> _models; // _models[l]: model of level l
+			std::vector<std::vector<int>> _merged_into; // _merged_into[l][v]: ID of the variable of level l+1 merging the variable v of level l
+			std::vector<int> _number_variables; // _number_variables[l]: number of variables of level l
+
+			// Match variables of the given model, and write the ID of the coarse variable of each of them in merged_into.
+			// Return the number of coarse variables.
+			int match_variables( const Model& model, std::vector<int>& merged_into, randutils::mt19937_rng& rng ) const;
+
+			bool can_merge( const Model& model, const std::vector<std::vector<int>>& variable_constraints, int variable_1, int variable_2 ) const;
+
+			Model coarsen( const Model& model, const std::vector<int>& merged_into, int number_coarse_variables ) const;
+
+		public:
+			/*!
+			 * Unique constructor, coarsening the given model until reaching coarsest_size variables.
+			 * \param model the model of level 0. It must not be a permutation problem nor have auxiliary data.
+			 * \param coarsest_size the number of variables below which coarsening stops.
+			 * \param rng a reference to a pseudo-random generator, to visit variables in random order.
+			 */
+			Multilevel( Model&& model, int coarsest_size, randutils::mt19937_rng& rng );
+
+			//! Number of coarse levels, i.e., the level of the coarsest model.
+			inline int get_number_levels() const { return static_cast<int>( _models.size() ) - 1; }
+
+			//! Number of variables of the model of the given level.
+			inline int get_number_variables( int level ) const { return _number_variables[ level ]; }
+
+			//! Move out the model of the given level.
+			inline Model&& transfer_model( int level ) { return std::move( _models[ level ] ); }
+
+			/*!
+			 * Project values of variables of the given level to the previous one.
+			 * \param level the level of the given values, strictly positive.
+			 * \param values the values of variables of the given level.
+			 * \return The values of variables of level - 1.
+			 */
+			std::vector<int> project( int level, const std::vector<int>& values ) const;
+		};
+	}
+}
@@ -0,0 +1,102 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+
+#include "../search_unit_data.hpp"
+#include "../thirdparty/randutils.hpp"
+
+namespace ghost
+{
+	namespace algorithms
+	{
+		/*!
+		 * A move assigns new values to several variables at once: variables[i] takes the value values[i].
+		 */
+		struct Move
+		{
+			std::vector<int> variables; //!< IDs of the variables changed by the move.
+			std::vector<int> values; //!< New value of each variable.
+		};
+
+		/*!
+		 * Neighborhood follows the Strategy design pattern to implement neighborhoods of compound moves,
+		 * changing several variables at once.
+		 *
+		 * Neighborhoods given in Options::neighborhoods are explored, in this order, each time
+		 * changing the value of the selected variable (or swapping it, for permutation problems)
+		 * does not decrease the error. The first neighborhood containing an improving move
+		 * stops the exploration and the solver makes this move, so that the next iteration
+		 * starts again with the simplest neighborhood, like Variable Neighborhood Descent.
+		 *
+		 * Moves are evaluated with Constraint::optional_delta_error and Objective::optional_delta_cost
+		 * over several variables, and applied by calling Constraint::conditional_update_data_structures
+		 * on each changed variable while all variables still have their former values, like swaps
+		 * in permutation problems.
+		 *
+		 * Users can derive their own neighborhoods from this class. Neighborhoods are shared among
+		 * parallel runs, so get_moves must not modify the neighborhood.
+		 */
+		class Neighborhood
+		{
+		protected:
+			std::string name;
+
+		public:
+			Neighborhood( std::string&& name )
+				: name( std::move( name ) )
+			{ }
+
+			//! Default virtual destructor.
+			virtual ~Neighborhood() = default;
+
+			inline std::string get_name() const { return name; }
+
+			/*!
+			 * Pure virtual method returning the moves of the neighborhood changing the given variable.
+			 *
+			 * Moves must only assign values from the domain of each variable. For permutation problems,
+			 * moves must keep the multiset of values unchanged, like swaps do.
+			 *
+			 * \param variable_to_change the ID of the variable selected by the solver.
+			 * \param data a const reference to the data of the search unit.
+			 * \param model a const reference to the model, to get the variables and their values.
+			 * \param rng a reference to the pseudo-random generator of the search unit, for sampled neighborhoods.
+			 * \return The vector of moves. Each move should contain variable_to_change.
+			 */
+			virtual std::vector<Move> get_moves( int variable_to_change,
+			                                     const SearchUnitData& data,
+			                                     const Model& model,
+			                                     randutils::mt19937_rng& rng ) const = 0;
+		};
+	}
+}
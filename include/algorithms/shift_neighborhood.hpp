@@ -0,0 +1,64 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "neighborhood.hpp"
+
+namespace ghost
+{
+	namespace algorithms
+	{
+		/*!
+		 * Neighborhood for sequences, where variables are the positions of the sequence in the
+		 * order of their IDs. A shift (or insert) move takes the value of the selected variable
+		 * out of the sequence and inserts it at another position, moving all values in between by
+		 * one position.
+		 */
+		class ShiftNeighborhood : public Neighborhood
+		{
+			int _max_distance;
+
+		public:
+			/*!
+			 * Constructor.
+			 * \param max_distance the maximal number of positions a value can be moved by. Set to -1
+			 * (default) to consider all positions.
+			 */
+			ShiftNeighborhood( int max_distance = -1 );
+
+			std::vector<Move> get_moves( int variable_to_change,
+			                             const SearchUnitData& data,
+			                             const Model& model,
+			                             randutils::mt19937_rng& rng ) const override;
+		};
+	}
+}
@@ -0,0 +1,114 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "../memory_usage.hpp"
+
+namespace ghost
+{
+	namespace algorithms
+	{
+		/*
+		 * VariableCandidates is the set of variables a VariableCandidatesHeuristic gives to a VariableHeuristic.
+		 * The same object is filled again at each computation of candidates, keeping its memory.
+		 *
+		 * List-based heuristics, like Adaptive Search, only add the IDs of candidate variables. Proportional
+		 * heuristics, like Antidote Search, also give a weight to each variable, to pick variables with a
+		 * probability proportional to their weight. Removing a candidate is done in constant time: the last
+		 * candidate takes its place in the list of IDs, and its weight is set to 0.
+		 */
+		class VariableCandidates
+		{
+			std::vector<int> _ids; // IDs of candidate variables, in no particular order
+			std::vector<int> _positions; // _positions[v]: index of the variable v in _ids, -1 if v is not a candidate
+			std::vector<double> _weights; // _weights[v]: weight of the variable v, empty for list-based heuristics
+
+		public:
+			// Remove all candidates, for a model with the given number of variables.
+			// If weighted is true, weights of all variables are set to 0, and are left empty otherwise.
+			inline void clear( int number_variables, bool weighted = false )
+			{
+				for( int variable_id : _ids )
+					_positions[ variable_id ] = -1;
+				_ids.clear();
+				_positions.resize( number_variables, -1 );
+
+				if( weighted )
+					_weights.assign( number_variables, 0.0 );
+				else
+					_weights.clear();
+			}
+
+			// Add a candidate, if it is not already one.
+			inline void add( int variable_id )
+			{
+				if( _positions[ variable_id ] >= 0 )
+					return;
+
+				_positions[ variable_id ] = static_cast<int>( _ids.size() );
+				_ids.push_back( variable_id );
+			}
+
+			// Remove a candidate, if it is one, and set its weight to 0.
+			inline void remove( int variable_id )
+			{
+				if( !_weights.empty() )
+					_weights[ variable_id ] = 0.0;
+
+				int position = _positions[ variable_id ];
+				if( position < 0 )
+					return;
+
+				int last_id = _ids.back();
+				_ids[ position ] = last_id;
+				_positions[ last_id ] = position;
+				_ids.pop_back();
+				_positions[ variable_id ] = -1;
+			}
+
+			inline void set_weight( int variable_id, double weight ) { _weights[ variable_id ] = weight; }
+
+			inline bool contains( int variable_id ) const { return _positions[ variable_id ] >= 0; }
+			inline bool empty() const { return _ids.empty(); }
+			inline int size() const { return static_cast<int>( _ids.size() ); }
+			inline int operator[]( int index ) const { return _ids[ index ]; }
+
+			inline const std::vector<int>& get_ids() const { return _ids; }
+			inline const std::vector<double>& get_weights() const { return _weights; }
+
+			inline std::size_t memory_usage() const
+			{
+				return MemoryUsage::heap_bytes( _ids ) + MemoryUsage::heap_bytes( _positions ) + MemoryUsage::heap_bytes( _weights );
+			}
+		};
+	}
+}
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "../search_unit_data.hpp"
+#include "variable_candidates.hpp"
 // #include "../macros.hpp"
 
 namespace ghost
@@ -56,9 +57,9 @@ namespace ghost
 
 			inline std::string get_name() const { return name; }
 
-			// returns a vector of double to be more generic, allowing for instance a vector of errors
-			// rather than a vector of ID, like it would certainly be often the case in practice.
-			virtual std::vector<double> compute_variable_candidates( const SearchUnitData& data ) const = 0;
+			// Fill candidates with variable IDs, and with weights for proportional heuristics.
+			// candidates is reused from one call to the next, to avoid allocations.
+			virtual void compute_variable_candidates( const SearchUnitData& data, VariableCandidates& candidates ) const = 0;
 		};
 	}
 }
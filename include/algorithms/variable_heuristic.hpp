@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "../search_unit_data.hpp"
+#include "variable_candidates.hpp"
 // #include "../macros.hpp"
 #include "../thirdparty/randutils.hpp"
 
@@ -57,9 +58,8 @@ namespace ghost
 
 			inline std::string get_name() const { return name; }
 
-			// candidates is a vector of double to be more generic, allowing for instance a vector of errors
-			// rather than a vector of ID, like it would certainly be often the case in practice.
-			virtual int select_variable_candidate( const std::vector<double>& candidates, const SearchUnitData& data, randutils::mt19937_rng& rng ) const = 0;
+			// candidates is never empty.
+			virtual int select_variable_candidate( const VariableCandidates& candidates, const SearchUnitData& data, randutils::mt19937_rng& rng ) const = 0;
 		};
 	}
 }
@@ -36,6 +36,12 @@
 
 namespace ghost
 {
+	namespace algorithms
+	{
+		class ExhaustiveSearch;
+		class Intensification;
+	}
+
 	/*******************/
 	/** AuxiliaryData **/
 	/*******************/
@@ -56,6 +62,9 @@ namespace ghost
 	{
 		friend class SearchUnit;
 		friend class ModelBuilder;
+		friend struct Model;
+		friend class algorithms::ExhaustiveSearch;
+		friend class algorithms::Intensification;
 
 		std::vector<Variable*> _variables;
 		std::vector<int> _variables_index; // To know where are the constraint's variables in the global variable vector
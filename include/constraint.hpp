@@ -32,6 +32,7 @@
 
 #include <vector>
 #include <map>
+#include <memory>
 #include <utility>
 #include <iostream>
 #include <typeinfo>
@@ -41,6 +42,7 @@
 #include <string>
 
 #include "variable.hpp"
+#include "memory_usage.hpp"
 
 namespace ghost
 {
@@ -48,8 +50,14 @@ namespace ghost
 	{
 		class AdaptiveSearchErrorProjection;
 		class CulpritSearchErrorProjection;
+		class Multilevel;
+		class ProjectedConstraint;
+		class ExhaustiveSearch;
+		class Intensification;
 	}
 
+	class ConstraintChecker; // Unit test helper checking incremental methods against required_error
+
 	/*!
 	 * This is the base class from which users need to derive their Constraint classes. 
 	 *
@@ -63,8 +71,14 @@ namespace ghost
 	{
 		friend class SearchUnit;
 		friend class ModelBuilder;
+		friend struct Model;
 		friend class algorithms::AdaptiveSearchErrorProjection;
 		friend class algorithms::CulpritSearchErrorProjection;
+		friend class algorithms::Multilevel;
+		friend class algorithms::ProjectedConstraint;
+		friend class algorithms::ExhaustiveSearch;
+		friend class algorithms::Intensification;
+		friend class ConstraintChecker;
 
 		std::vector<Variable*> _variables;
 		std::vector<int> _variables_index; // To know where are the constraint's variables in the global variable vector
@@ -74,6 +88,10 @@ namespace ghost
 
 		int _id; // Unique ID integer
 		mutable bool _is_optional_delta_error_defined; // Boolean telling if optional_delta_error() is overrided or not.
+		mutable bool _is_optional_delta_error_on_domain_defined; // Boolean telling if optional_delta_error_on_domain() is overrided or not.
+		mutable bool _is_optional_plausible_values_defined; // Boolean telling if optional_plausible_values() is overrided or not.
+		mutable bool _is_optional_batch_error_defined; // Boolean telling if optional_batch_error() is overrided or not.
+		bool _is_permutation_invariant; // Boolean telling if swaps within the constraint's scope are skipped in permutation problems.
 
 		struct nanException : std::exception
 		{
@@ -114,6 +132,14 @@ namespace ghost
 				message += std::to_string( ptr_variables[ static_cast<int>( ptr_variables.size() ) - 1 ]->get_value() ) + ")\n";
 			}
 
+			negativeException( const std::vector<Variable>& variables ) : variables(variables)
+			{
+				message = "Constraint optional_batch_error returned a negative value on variables (";
+				for( int i = 0; i < static_cast<int>( variables.size() ) - 1; ++i )
+					message += std::to_string( variables[i].get_value() ) + ", ";
+				message += std::to_string( variables[ static_cast<int>( variables.size() ) - 1 ].get_value() ) + ")\n";
+			}
+
 			const char* what() const noexcept { return message.c_str(); }
 		};
 
@@ -128,6 +154,50 @@ namespace ghost
 			const char* what() const noexcept { return message.c_str(); }
 		};
 
+		struct deltaErrorOnDomainNotDefinedException : std::exception
+		{
+			std::string message;
+
+			deltaErrorOnDomainNotDefinedException()
+			{
+				message = "Constraint::optional_delta_error_on_domain() has not been user-defined.\n";
+			}
+			const char* what() const noexcept { return message.c_str(); }
+		};
+
+		struct plausibleValuesNotDefinedException : std::exception
+		{
+			std::string message;
+
+			plausibleValuesNotDefinedException()
+			{
+				message = "Constraint::optional_plausible_values() has not been user-defined.\n";
+			}
+			const char* what() const noexcept { return message.c_str(); }
+		};
+
+		struct batchErrorNotDefinedException : std::exception
+		{
+			std::string message;
+
+			batchErrorNotDefinedException()
+			{
+				message = "Constraint::optional_batch_error() has not been user-defined.\n";
+			}
+			const char* what() const noexcept { return message.c_str(); }
+		};
+
+		struct coarsenNotDefinedException : std::exception
+		{
+			std::string message;
+
+			coarsenNotDefinedException()
+			{
+				message = "Constraint::optional_coarsen() has not been user-defined.\n";
+			}
+			const char* what() const noexcept { return message.c_str(); }
+		};
+
 		struct variableOutOfTheScope : std::exception
 		{
 			std::string message;
@@ -141,6 +211,10 @@ namespace ghost
 
 		inline bool is_optional_delta_error_defined() { return _is_optional_delta_error_defined; }
 
+		inline bool is_optional_plausible_values_defined() const { return _is_optional_plausible_values_defined; }
+
+		inline bool is_optional_batch_error_defined() const { return _is_optional_batch_error_defined; }
+
 		// Call required_error() after getting sure the error does give a nan, rise an exception otherwise.
 		double error() const;
 
@@ -153,6 +227,24 @@ namespace ghost
 		// This calls delta_error() if the user overrided it, otherwise it makes the simulation 'by hand' and calls error()
 		double simulate_delta( const std::vector<int>& variables_index, const std::vector<int>& candidate_values );
 
+		// Compute the delta errors of assigning each candidate value to the given variable, by calling optional_delta_error_on_domain.
+		// Getting sure none of the delta errors is a nan, rise an exception otherwise.
+		std::vector<double> delta_error_on_domain( int variable_index, const std::vector<int>& candidate_values ) const;
+
+		// To simulate the error deltas between the current configuration and each candidate configuration where
+		// only the given variable changes. This calls delta_error_on_domain() if the user overrided it, otherwise
+		// it calls simulate_delta() for each candidate value.
+		std::vector<double> simulate_delta_on_domain( int variable_index, const std::vector<int>& candidate_values );
+
+		// Filter candidate values of the given variable by calling optional_plausible_values after making the conversion of variable index.
+		std::vector<int> plausible_values( int variable_index, const std::vector<int>& candidate_values ) const;
+
+		// Compute the errors of a batch of complete assignments by calling optional_batch_error, after gathering the
+		// rows of the constraint's variables from 'samples', where samples[ variable_id * number_samples + k ] is the
+		// value of the variable of id variable_id in the k-th assignment.
+		// Getting sure none of the errors is a nan or is negative, rise an exception otherwise.
+		std::vector<double> batch_error( const std::vector<int>& samples, int number_samples ) const;
+
 		// Return ids of variable objects in _variables.
 		inline std::vector<int> get_variable_ids() const { return _variables_index; }
 
@@ -239,6 +331,181 @@ namespace ghost
 		 */
 		virtual double optional_delta_error( const std::vector<Variable*>& variables, const std::vector<int>& indexes, const std::vector<int>& candidate_values ) const;
 
+		/*!
+		 * Virtual method to compute at once the delta errors of all candidate values of one variable.
+		 *
+		 * This is the batched version of optional_delta_error, where only one variable changes:
+		 * the i-th element of the output must be equal to what optional_delta_error would output
+		 * with variable_index and candidate_values[i]. The solver calls this method to evaluate
+		 * the neighborhood of the selected variable, so overriding it makes sense when the delta
+		 * errors of all values can be computed faster together than one after the other, for
+		 * instance by sharing the part of the computation related to the current value of the
+		 * variable, or by using a loop the compiler can vectorize.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory. If it
+		 * is not overridden, the solver calls optional_delta_error (or simulates deltas by hand)
+		 * for each candidate value.
+		 *
+		 * \warning DO NOT implement any side effect in this method.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the scope
+		 * of the constraint.
+		 * \param variable_index the index of the variable in 'variables' that is reassigned.
+		 * \param candidate_values the vector of candidate values for this variable.
+		 * \return A vector of doubles, of the same size than candidate_values, containing the
+		 * difference between the current error of the constraint and the error one would get if
+		 * the solver assigns each candidate value to the variable.
+		 * \exception Throws an exception if one of the computed values is NaN.
+		 */
+		virtual std::vector<double> optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+		                                                            int variable_index,
+		                                                            const std::vector<int>& candidate_values ) const;
+
+		/*!
+		 * Virtual method to filter the candidate values of one variable, keeping only the values
+		 * that may decrease the error of the constraint given the current values of the other
+		 * variables.
+		 *
+		 * This method must be much cheaper than computing delta errors, like checking bounds or
+		 * counters the constraint already maintains. It may keep values that do not decrease
+		 * the error, but must never filter out a value that does.
+		 *
+		 * When all constraints containing the variable selected by the solver override this
+		 * method, the solver first simulates the delta errors of values kept by at least one of
+		 * them, and only simulates the other values if none of the kept ones decreases the
+		 * global error. This is only done while the current assignment violates some
+		 * constraints, and not for permutation problems.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory.
+		 *
+		 * \warning DO NOT implement any side effect in this method.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the scope
+		 * of the constraint.
+		 * \param variable_index the index of the variable in 'variables' that is reassigned.
+		 * \param candidate_values the vector of candidate values for this variable.
+		 * \return The vector of values from candidate_values that may decrease the error of the
+		 * constraint, in the same order.
+		 */
+		virtual std::vector<int> optional_plausible_values( const std::vector<Variable*>& variables,
+		                                                    int variable_index,
+		                                                    const std::vector<int>& candidate_values ) const;
+
+		/*!
+		 * Virtual method to compute at once the errors of a batch of complete assignments.
+		 *
+		 * This is the batched version of required_error: the k-th element of the output must be
+		 * equal to what required_error would output if the variables of the constraint were
+		 * assigned to their values in the k-th assignment. Values are given as a structure of
+		 * arrays: the value of variables[i] in the k-th assignment is values[ i * number_samples + k ],
+		 * so that a loop over the assignments reads contiguous memory and can be vectorized by the
+		 * compiler. The solver calls this method to evaluate its starting samplings, without
+		 * assigning the variables.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory. If it
+		 * is not overridden, the solver assigns the variables of each sampling and calls
+		 * required_error.
+		 *
+		 * \warning DO NOT implement any side effect in this method. Current values of variables
+		 * must be ignored.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the scope
+		 * of the constraint.
+		 * \param values the values of the variables in each assignment, as described above.
+		 * \param number_samples the number of assignments in the batch.
+		 * \return A vector of doubles, of size number_samples, containing the error of the
+		 * constraint for each assignment.
+		 * \exception Throws an exception if one of the computed values is NaN or negative.
+		 */
+		virtual std::vector<double> optional_batch_error( const std::vector<Variable*>& variables,
+		                                                  const std::vector<int>& values,
+		                                                  int number_samples ) const;
+
+		/*!
+		 * Virtual method to declare the constraint invariant under permutations of the values of
+		 * its variables, like AllDifferent or a sum with equal coefficients.
+		 *
+		 * In permutation problems, swapping the values of two variables of such a constraint
+		 * changes neither its error nor its inner data structures. The solver then neither
+		 * simulates these swaps on the constraint nor updates it after them.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory. By
+		 * default, constraints are not declared permutation-invariant.
+		 *
+		 * \warning If the constraint maintains inner data structures in
+		 * conditional_update_data_structures, they must also be left unchanged by such swaps.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the scope
+		 * of the constraint.
+		 * \return True if and only if the error of the constraint does not depend on which of its
+		 * variables takes which value.
+		 */
+		virtual bool optional_is_permutation_invariant( const std::vector<Variable*>& variables ) const;
+
+		/*!
+		 * Virtual method to report the memory taken by inner data structures of derived
+		 * constraint classes, in bytes. It is added to the memory usage of models (see
+		 * Model::memory_usage and Solver::memory_usage), where data structures of the Constraint
+		 * base class are already counted.
+		 *
+		 * MemoryUsage::heap_bytes estimates the memory owned by standard containers.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory. By
+		 * default, derived classes are assumed to have no inner data structures.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the scope
+		 * of the constraint.
+		 * \return The number of bytes taken by inner data structures of the constraint.
+		 */
+		virtual std::size_t optional_memory_usage( const std::vector<Variable*>& variables ) const;
+
+		/*!
+		 * Virtual method to tell if two variables of the constraint can be merged into one variable
+		 * by the multilevel mode of the solver (see Options::multilevel). Merged variables always
+		 * take the same value on coarse models.
+		 *
+		 * Override this method to forbid merging variables that must take different values,
+		 * or merges making the constraint unsatisfiable on coarse models. It is only called for
+		 * variables with the same domain.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory. By
+		 * default, any two variables can be merged.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the scope
+		 * of the constraint.
+		 * \param index_1 the index of the first variable in 'variables'.
+		 * \param index_2 the index of the second variable in 'variables'.
+		 * \return True if and only if variables[index_1] and variables[index_2] can be merged.
+		 */
+		virtual bool optional_can_merge( const std::vector<Variable*>& variables, int index_1, int index_2 ) const;
+
+		/*!
+		 * Virtual method to build the version of the constraint on a coarse model of the multilevel
+		 * mode of the solver (see Options::multilevel), where some variables have been merged into
+		 * one variable.
+		 *
+		 * The output constraint must be built on the coarse variable IDs given in
+		 * coarse_variables_index, and its error for an assignment of coarse variables must be equal
+		 * to the error of this constraint when each of its variables takes the value of the coarse
+		 * variable it has been merged into. For instance, a linear equation sums the coefficients
+		 * of merged variables.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory. If it
+		 * is not overridden, the solver evaluates coarse assignments by projecting them on the
+		 * variables of this constraint and calling required_error, which is slower.
+		 *
+		 * \warning The output constraint may keep a pointer to this constraint, which outlives it.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the scope
+		 * of the constraint.
+		 * \param coarse_variables_index the vector of the same size than 'variables', where
+		 * coarse_variables_index[i] is the ID of the coarse variable variables[i] has been merged into.
+		 * Several variables can be merged into the same coarse variable.
+		 * \return A shared pointer to the coarse constraint.
+		 */
+		virtual std::shared_ptr<Constraint> optional_coarsen( const std::vector<Variable*>& variables,
+		                                                      const std::vector<int>& coarse_variables_index ) const;
+
 		/*!
 		 * Update user-defined data structures in the constraint.
 		 *
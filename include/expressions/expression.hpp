@@ -0,0 +1,174 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "../variable.hpp"
+
+namespace ghost
+{
+	namespace expressions
+	{
+		//! Kinds of nodes in expression graphs.
+		enum class ExpressionKind
+		{
+			Constant,
+			Variable,
+			Sum, // weighted sum plus a constant
+			Product,
+			Minimum,
+			Maximum,
+			Absolute,
+			Equal, // violation degree |a - b|
+			NotEqual, // violation degree 1 if a = b, 0 otherwise
+			LessEqual, // violation degree max( 0, a - b )
+			Less, // violation degree max( 0, a - b + 1 )
+			Element, // array[ index ], with index clamped to the array bounds
+			Count // number of children equal to a value
+		};
+
+		/*!
+		 * Node of an expression graph. Nodes are immutable once built, and can be shared among
+		 * several expressions, making expression graphs directed acyclic graphs (DAGs).
+		 *
+		 * Users never build nodes directly, but use Expression objects and their functions and
+		 * operators.
+		 */
+		struct ExpressionNode
+		{
+			ExpressionKind kind;
+			std::vector<std::shared_ptr<const ExpressionNode>> children;
+			std::vector<double> coefficients; // coefficients of Sum children
+			std::vector<double> array; // array of Element nodes
+			double constant; // value of Constant nodes, constant term of Sum nodes, counted value of Count nodes
+			int variable_id; // ID of the variable of Variable nodes
+
+			ExpressionNode( ExpressionKind kind,
+			                std::vector<std::shared_ptr<const ExpressionNode>> children = {},
+			                double constant = 0.0 );
+		};
+
+		/*!
+		 * Expression is a handle on an expression graph over GHOST variables, built with the
+		 * functions of the ghost::expressions namespace and arithmetic operators. For instance:
+		 *
+		 * \code
+		 * using namespace ghost::expressions;
+		 * Expression makespan = maximum( { Expression( start[0] ) + 3, Expression( start[1] ) + 2 } );
+		 * Expression capacity = less_equal( sum( loads ), 10 );
+		 * \endcode
+		 *
+		 * Expression graphs are compiled into an ExpressionNetwork by ExpressionConstraint,
+		 * MinimizeExpression and MaximizeExpression, to evaluate them incrementally.
+		 *
+		 * Expressions are evaluated with doubles. Comparisons output a violation degree rather than
+		 * a Boolean value, i.e., 0 if the comparison holds, and how far it is from holding otherwise,
+		 * such that they can be directly used as constraint errors. Strict comparisons assume
+		 * integer operands.
+		 *
+		 * \sa ExpressionNetwork, ExpressionConstraint, MinimizeExpression, MaximizeExpression
+		 */
+		class Expression
+		{
+			std::shared_ptr<const ExpressionNode> _node;
+
+		public:
+			//! Constructor from a node. Users should not need it.
+			explicit Expression( std::shared_ptr<const ExpressionNode> node );
+
+			//! Constructor of a constant expression.
+			Expression( double value );
+
+			//! Constructor of a constant expression.
+			Expression( int value );
+
+			//! Constructor of an expression equals to the value of the given variable.
+			Expression( const Variable& variable );
+
+			//! Inline method returning the root node of the expression graph.
+			inline const std::shared_ptr<const ExpressionNode>& get_node() const { return _node; }
+		};
+
+		//! Expression equals to the value of the variable with the given ID.
+		Expression variable( int variable_id );
+
+		//! Sum of the given expressions.
+		Expression sum( const std::vector<Expression>& terms );
+
+		//! Weighted sum of the given expressions, plus a constant.
+		Expression sum( const std::vector<Expression>& terms, const std::vector<double>& coefficients, double constant = 0.0 );
+
+		//! Sum of the values of the given variables.
+		Expression sum( const std::vector<Variable>& variables );
+
+		//! Product of the given expressions.
+		Expression product( const std::vector<Expression>& factors );
+
+		//! Minimum of the given expressions.
+		Expression minimum( const std::vector<Expression>& terms );
+
+		//! Maximum of the given expressions.
+		Expression maximum( const std::vector<Expression>& terms );
+
+		//! Absolute value of the given expression.
+		Expression absolute( const Expression& term );
+
+		//! Violation degree of lhs = rhs, i.e., |lhs - rhs|.
+		Expression equal( const Expression& lhs, const Expression& rhs );
+
+		//! Violation degree of lhs != rhs, i.e., 1 if lhs = rhs, 0 otherwise.
+		Expression not_equal( const Expression& lhs, const Expression& rhs );
+
+		//! Violation degree of lhs <= rhs, i.e., max( 0, lhs - rhs ).
+		Expression less_equal( const Expression& lhs, const Expression& rhs );
+
+		//! Violation degree of lhs < rhs for integer operands, i.e., max( 0, lhs - rhs + 1 ).
+		Expression less( const Expression& lhs, const Expression& rhs );
+
+		//! Violation degree of lhs >= rhs, i.e., max( 0, rhs - lhs ).
+		Expression greater_equal( const Expression& lhs, const Expression& rhs );
+
+		//! Violation degree of lhs > rhs for integer operands, i.e., max( 0, rhs - lhs + 1 ).
+		Expression greater( const Expression& lhs, const Expression& rhs );
+
+		//! Value of array[ index ], with index rounded and clamped to the bounds of the non-empty array.
+		Expression element( const Expression& index, const std::vector<double>& array );
+
+		//! Number of the given expressions equal to value.
+		Expression count( const std::vector<Expression>& terms, double value );
+
+		Expression operator+( const Expression& lhs, const Expression& rhs );
+		Expression operator-( const Expression& lhs, const Expression& rhs );
+		Expression operator-( const Expression& term );
+		Expression operator*( const Expression& lhs, const Expression& rhs );
+	}
+}
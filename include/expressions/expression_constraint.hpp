@@ -0,0 +1,83 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+#include "expression.hpp"
+#include "expression_network.hpp"
+
+namespace ghost
+{
+	namespace expressions
+	{
+		/*!
+		 * Constraint whose error is the value of an expression graph, typically built with comparisons
+		 * that output violation degrees. For instance, the following constraint is satisfied if the sum
+		 * of x, y and z is at most 10, with an error equals to how much the sum exceeds 10:
+		 *
+		 * \code
+		 * ExpressionConstraint( less_equal( sum( { x, y, z } ), 10 ) )
+		 * \endcode
+		 *
+		 * The scope of the constraint is composed of all variables in the expression. The expression
+		 * must output non-negative values.
+		 *
+		 * Users do not need to write required_error, optional_delta_error nor
+		 * conditional_update_data_structures: the expression graph is compiled into an ExpressionNetwork
+		 * giving exact delta errors by incremental evaluation.
+		 *
+		 * \sa Expression, ExpressionNetwork
+		 */
+		class ExpressionConstraint : public Constraint
+		{
+			mutable ExpressionNetwork _network;
+
+			ExpressionConstraint( ExpressionNetwork&& network );
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables, int index, int new_value ) override;
+
+		public:
+			/*!
+			 * Constructor compiling the given expression.
+			 * \param expression the expression giving the error of the constraint, over at least one variable.
+			 */
+			ExpressionConstraint( const Expression& expression );
+		};
+	}
+}
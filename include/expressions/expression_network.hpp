@@ -0,0 +1,140 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <functional>
+
+#include "../variable.hpp"
+#include "expression.hpp"
+
+namespace ghost
+{
+	namespace expressions
+	{
+		/*!
+		 * ExpressionNetwork is an expression graph compiled into an invariant network: nodes are stored
+		 * in a topological order (children before parents), each node knows its parents, and the
+		 * value of each node is kept up to date while variables change.
+		 *
+		 * After a full evaluation, changing some variables only re-evaluates the nodes depending on
+		 * them, in topological order, and stops propagating through nodes whose value did not change.
+		 * Weighted sums and counts are updated in constant time per changed child; other nodes are
+		 * re-evaluated from their children.
+		 *
+		 * Variables of the network are identified by their position in get_variable_ids(), i.e.,
+		 * their IDs sorted in increasing order, to match positions of variables in constraints and
+		 * objective functions built with these IDs.
+		 */
+		class ExpressionNetwork
+		{
+			// Compiled graph, nodes being in topological order: the last node is the root.
+			std::vector<ExpressionKind> _kinds;
+			std::vector<double> _constants;
+			std::vector<int> _children_start; // children of node n are _children[ _children_start[n] .. _children_start[n+1] [
+			std::vector<int> _children;
+			std::vector<double> _coefficients; // parallel to _children, for Sum nodes
+			std::vector<int> _parents_start; // parents of node n are _parents[ _parents_start[n] .. _parents_start[n+1] [
+			std::vector<int> _parents;
+			std::vector<int> _parents_slot; // parallel to _parents: index of the child in the parent's children
+			std::vector<int> _arrays_start; // arrays of Element nodes
+			std::vector<double> _arrays;
+
+			std::vector<int> _variable_ids; // sorted IDs of variables in the graph
+			std::vector<int> _variable_nodes; // node of each variable, by position
+
+			// Current value of each node
+			std::vector<double> _values;
+
+			// Scratch data for propagations. A node is touched (resp. queued) during the current propagation
+			// iff its stamp equals _stamp.
+			int _stamp;
+			std::vector<int> _touched_stamps;
+			std::vector<int> _queued_stamps;
+			std::vector<double> _new_values;
+			std::vector<double> _pending; // pending variations of Sum and Count nodes
+			std::vector<int> _touched_nodes;
+			std::priority_queue<int, std::vector<int>, std::greater<int>> _queue;
+
+			inline double current_value( int node ) const
+			{
+				return _touched_stamps[ node ] == _stamp ? _new_values[ node ] : _values[ node ];
+			}
+
+			// Evaluate a node from the current values of its children.
+			double evaluate_node( int node ) const;
+
+			// Set a new value to a node, and queue its parents if the value changed.
+			void change_node( int node, double new_value );
+
+			// Propagate changes of variables given by their positions, and return the new root value.
+			double propagate( const std::vector<int>& variable_positions, const std::vector<int>& new_values );
+
+		public:
+			/*!
+			 * Constructor compiling the expression graph of the given root.
+			 * \param root the expression to compile.
+			 */
+			ExpressionNetwork( const Expression& root );
+
+			/*!
+			 * Inline method returning the sorted IDs of variables in the expression graph.
+			 */
+			inline const std::vector<int>& get_variable_ids() const { return _variable_ids; }
+
+			/*!
+			 * Method evaluating the whole network from scratch.
+			 * \param variables a vector of pointers to the variables of the network, ordered by position.
+			 * \return The value of the root expression.
+			 */
+			double evaluate( const std::vector<Variable*>& variables );
+
+			/*!
+			 * Method computing the value of the root expression if some variables change, without
+			 * modifying the network.
+			 * \param variable_positions positions of the variables to change.
+			 * \param new_values their new values.
+			 * \return The new value of the root expression.
+			 */
+			double simulate( const std::vector<int>& variable_positions, const std::vector<int>& new_values );
+
+			/*!
+			 * Method changing the value of a variable, and updating the network accordingly.
+			 * \param variable_position the position of the changed variable.
+			 * \param new_value its new value.
+			 */
+			void update( int variable_position, int new_value );
+
+			//! Inline method returning the current value of the root expression.
+			inline double get_value() const { return _values.back(); }
+		};
+	}
+}
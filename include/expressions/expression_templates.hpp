@@ -0,0 +1,420 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <initializer_list>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	/*!
+	 * Header-only expression templates to write constraints of the form
+	 * sum( f( x_i ) ) <op> rhs, where f is an element-wise expression over an array of
+	 * variables x, for instance:
+	 *
+	 * \code
+	 * auto x = ghost::expr::vars( variables );
+	 * auto w = ghost::expr::coefficients( { 12, 2, 1, 1, 4 } );
+	 * constraints.emplace_back( ghost::expr::make_constraint( ghost::expr::sum( w * x ) <= 15 ) );
+	 * \endcode
+	 *
+	 * The whole expression is encoded in the type of the constraint returned by make_constraint,
+	 * so that its error, delta errors and incremental update are inlined by the compiler, with
+	 * no virtual calls nor expression graph traversal. Unlike ghost::expressions, these
+	 * expressions are restricted to separable sums, i.e., sums where each term depends on one
+	 * variable only, but they are as fast as a hand-written constraint.
+	 */
+	namespace expr
+	{
+		//! Exception thrown when an expression mixes several variable arrays, or arrays of different sizes.
+		struct expressionException : std::exception
+		{
+			std::string message;
+			expressionException( const std::string& message ) : message( message ) {}
+			const char* what() const noexcept { return message.c_str(); }
+		};
+
+		//! Base class tagging element-wise expressions, i.e., expressions computing a value for each variable of an array.
+		struct Elementwise {};
+
+		template<typename T>
+		constexpr bool is_elementwise_v = std::is_base_of_v<Elementwise, T>;
+
+		template<typename T>
+		constexpr bool is_operand_v = is_elementwise_v<T> || std::is_arithmetic_v<T>;
+
+		/*!
+		 * Element-wise expression giving the value of each variable of an array. This is the
+		 * only expression carrying the scope of the constraint.
+		 */
+		class VariableArray : public Elementwise
+		{
+			std::vector<int> _ids;
+
+		public:
+			explicit VariableArray( const std::vector<int>& variables_index )
+				: _ids( variables_index )
+			{ }
+
+			explicit VariableArray( const std::vector<Variable>& variables )
+				: _ids( variables.size() )
+			{
+				std::transform( variables.begin(), variables.end(), _ids.begin(), []( const auto& v ){ return v.get_id(); } );
+			}
+
+			inline int at( int, int value ) const { return value; }
+			inline const std::vector<int>* scope() const { return &_ids; }
+			inline bool has_size( std::size_t size ) const { return _ids.size() == size; }
+		};
+
+		/*!
+		 * Element-wise expression giving one coefficient per variable. The coefficient type is
+		 * kept, so that integer coefficients lead to integer computations.
+		 */
+		template<typename T>
+		class Coefficients : public Elementwise
+		{
+			std::vector<T> _values;
+
+		public:
+			explicit Coefficients( std::vector<T> values )
+				: _values( std::move( values ) )
+			{ }
+
+			inline T at( int index, int ) const { return _values[ index ]; }
+			inline const std::vector<int>* scope() const { return nullptr; }
+			inline bool has_size( std::size_t size ) const { return _values.size() == size; }
+		};
+
+		//! Element-wise expression giving the same value for each variable.
+		template<typename T>
+		class Constant : public Elementwise
+		{
+			T _value;
+
+		public:
+			explicit Constant( T value )
+				: _value( value )
+			{ }
+
+			inline T at( int, int ) const { return _value; }
+			inline const std::vector<int>* scope() const { return nullptr; }
+			inline bool has_size( std::size_t ) const { return true; }
+		};
+
+		struct Plus { template<typename A, typename B> static inline auto apply( A a, B b ) { return a + b; } };
+		struct Minus { template<typename A, typename B> static inline auto apply( A a, B b ) { return a - b; } };
+		struct Times { template<typename A, typename B> static inline auto apply( A a, B b ) { return a * b; } };
+
+		//! Element-wise binary operation.
+		template<typename L, typename R, typename Op>
+		class Binary : public Elementwise
+		{
+			L _lhs;
+			R _rhs;
+
+		public:
+			Binary( const L& lhs, const R& rhs )
+				: _lhs( lhs ),
+				  _rhs( rhs )
+			{
+				if( _lhs.scope() != nullptr && _rhs.scope() != nullptr && *_lhs.scope() != *_rhs.scope() )
+					throw expressionException( "Element-wise expressions must be over the same variable array.\n" );
+			}
+
+			inline auto at( int index, int value ) const { return Op::apply( _lhs.at( index, value ), _rhs.at( index, value ) ); }
+			inline const std::vector<int>* scope() const { return _lhs.scope() != nullptr ? _lhs.scope() : _rhs.scope(); }
+			inline bool has_size( std::size_t size ) const { return _lhs.has_size( size ) && _rhs.has_size( size ); }
+		};
+
+		//! Element-wise negation.
+		template<typename E>
+		class Negate : public Elementwise
+		{
+			E _term;
+
+		public:
+			explicit Negate( const E& term )
+				: _term( term )
+			{ }
+
+			inline auto at( int index, int value ) const { return -_term.at( index, value ); }
+			inline const std::vector<int>* scope() const { return _term.scope(); }
+			inline bool has_size( std::size_t size ) const { return _term.has_size( size ); }
+		};
+
+		template<typename T>
+		inline auto as_elementwise( const T& operand )
+		{
+			if constexpr( is_elementwise_v<T> )
+				return operand;
+			else
+				return Constant<T>( operand );
+		}
+
+		//! Element-wise expression of the given variables.
+		inline VariableArray vars( const std::vector<Variable>& variables ) { return VariableArray( variables ); }
+
+		//! Element-wise expression of the variables with the given IDs.
+		inline VariableArray vars( const std::vector<int>& variables_index ) { return VariableArray( variables_index ); }
+
+		//! Element-wise expression of the given coefficients, one per variable.
+		template<typename T>
+		inline Coefficients<T> coefficients( std::vector<T> values ) { return Coefficients<T>( std::move( values ) ); }
+
+		//! Element-wise expression of the given coefficients, one per variable.
+		template<typename T>
+		inline Coefficients<T> coefficients( std::initializer_list<T> values ) { return Coefficients<T>( std::vector<T>( values ) ); }
+
+		template<typename L, typename R, std::enable_if_t<( is_elementwise_v<L> || is_elementwise_v<R> ) && is_operand_v<L> && is_operand_v<R>, int> = 0>
+		inline auto operator+( const L& lhs, const R& rhs )
+		{
+			auto l = as_elementwise( lhs );
+			auto r = as_elementwise( rhs );
+			return Binary<decltype( l ), decltype( r ), Plus>( l, r );
+		}
+
+		template<typename L, typename R, std::enable_if_t<( is_elementwise_v<L> || is_elementwise_v<R> ) && is_operand_v<L> && is_operand_v<R>, int> = 0>
+		inline auto operator-( const L& lhs, const R& rhs )
+		{
+			auto l = as_elementwise( lhs );
+			auto r = as_elementwise( rhs );
+			return Binary<decltype( l ), decltype( r ), Minus>( l, r );
+		}
+
+		template<typename L, typename R, std::enable_if_t<( is_elementwise_v<L> || is_elementwise_v<R> ) && is_operand_v<L> && is_operand_v<R>, int> = 0>
+		inline auto operator*( const L& lhs, const R& rhs )
+		{
+			auto l = as_elementwise( lhs );
+			auto r = as_elementwise( rhs );
+			return Binary<decltype( l ), decltype( r ), Times>( l, r );
+		}
+
+		template<typename E, std::enable_if_t<is_elementwise_v<E>, int> = 0>
+		inline Negate<E> operator-( const E& term ) { return Negate<E>( term ); }
+
+		/*!
+		 * Sum over all variables of an element-wise expression, plus a constant offset.
+		 *
+		 * Sums are accumulated in the type of the element-wise expression, so integer
+		 * coefficients give exact integer sums; users must make sure this type cannot overflow.
+		 */
+		template<typename E>
+		class Sum
+		{
+			E _term;
+			double _offset;
+
+		public:
+			using value_type = decltype( std::declval<E>().at( 0, 0 ) );
+
+			Sum( const E& term, double offset = 0.0 )
+				: _term( term ),
+				  _offset( offset )
+			{
+				if( _term.scope() == nullptr )
+					throw expressionException( "Sums must be over an expression containing a variable array.\n" );
+				if( !_term.has_size( _term.scope()->size() ) )
+					throw expressionException( "Coefficient arrays must have one element per variable.\n" );
+			}
+
+			inline const E& get_term() const { return _term; }
+			inline double get_offset() const { return _offset; }
+		};
+
+		//! Sum of an element-wise expression over all variables.
+		template<typename E, std::enable_if_t<is_elementwise_v<E>, int> = 0>
+		inline Sum<E> sum( const E& term ) { return Sum<E>( term ); }
+
+		template<typename A, typename B>
+		inline auto operator+( const Sum<A>& lhs, const Sum<B>& rhs )
+		{
+			return Sum<Binary<A, B, Plus>>( Binary<A, B, Plus>( lhs.get_term(), rhs.get_term() ), lhs.get_offset() + rhs.get_offset() );
+		}
+
+		template<typename A, typename B>
+		inline auto operator-( const Sum<A>& lhs, const Sum<B>& rhs )
+		{
+			return Sum<Binary<A, B, Minus>>( Binary<A, B, Minus>( lhs.get_term(), rhs.get_term() ), lhs.get_offset() - rhs.get_offset() );
+		}
+
+		template<typename A>
+		inline Sum<Negate<A>> operator-( const Sum<A>& term ) { return Sum<Negate<A>>( Negate<A>( term.get_term() ), -term.get_offset() ); }
+
+		template<typename A, typename K, std::enable_if_t<std::is_arithmetic_v<K>, int> = 0>
+		inline Sum<A> operator+( const Sum<A>& lhs, K rhs ) { return Sum<A>( lhs.get_term(), lhs.get_offset() + rhs ); }
+
+		template<typename A, typename K, std::enable_if_t<std::is_arithmetic_v<K>, int> = 0>
+		inline Sum<A> operator+( K lhs, const Sum<A>& rhs ) { return rhs + lhs; }
+
+		template<typename A, typename K, std::enable_if_t<std::is_arithmetic_v<K>, int> = 0>
+		inline Sum<A> operator-( const Sum<A>& lhs, K rhs ) { return Sum<A>( lhs.get_term(), lhs.get_offset() - rhs ); }
+
+		template<typename A, typename K, std::enable_if_t<std::is_arithmetic_v<K>, int> = 0>
+		inline Sum<Negate<A>> operator-( K lhs, const Sum<A>& rhs ) { return -rhs + lhs; }
+
+		template<typename A, typename K, std::enable_if_t<std::is_arithmetic_v<K>, int> = 0>
+		inline auto operator*( K lhs, const Sum<A>& rhs )
+		{
+			return Sum<Binary<Constant<K>, A, Times>>( Binary<Constant<K>, A, Times>( Constant<K>( lhs ), rhs.get_term() ), lhs * rhs.get_offset() );
+		}
+
+		template<typename A, typename K, std::enable_if_t<std::is_arithmetic_v<K>, int> = 0>
+		inline auto operator*( const Sum<A>& lhs, K rhs ) { return rhs * lhs; }
+
+		/*
+		 * Comparison operators, with the same error functions than the LinearEquation constraints:
+		 * the error is zero if and only if the comparison holds.
+		 */
+		struct LessEqual { static inline double error( double sum, double rhs ) { return std::max( 0.0, sum - rhs ); } };
+		struct Less { static inline double error( double sum, double rhs ) { return std::max( 0.0, sum - rhs ) + ( sum == rhs ? 1.0 : 0.0 ); } };
+		struct GreaterEqual { static inline double error( double sum, double rhs ) { return std::max( 0.0, rhs - sum ); } };
+		struct Greater { static inline double error( double sum, double rhs ) { return std::max( 0.0, rhs - sum ) + ( sum == rhs ? 1.0 : 0.0 ); } };
+		struct Equal { static inline double error( double sum, double rhs ) { return std::abs( sum - rhs ); } };
+		struct NotEqual { static inline double error( double sum, double rhs ) { return sum == rhs ? 1.0 : 0.0; } };
+
+		//! Comparison between a sum and a constant, to give to make_constraint.
+		template<typename E, typename Op>
+		struct Relation
+		{
+			Sum<E> lhs;
+			double rhs;
+		};
+
+		template<typename Op, typename E, typename K, std::enable_if_t<std::is_arithmetic_v<K>, int> = 0>
+		inline Relation<E, Op> make_relation( const Sum<E>& lhs, K rhs ) { return Relation<E, Op>{ lhs, static_cast<double>( rhs ) }; }
+
+		template<typename Op, typename A, typename B>
+		inline auto make_relation( const Sum<A>& lhs, const Sum<B>& rhs ) { return make_relation<Op>( lhs - rhs, 0 ); }
+
+#define GHOST_EXPR_RELATION( op, Op, FlippedOp ) \
+		template<typename A, typename B> \
+		inline auto operator op( const Sum<A>& lhs, const Sum<B>& rhs ) { return make_relation<Op>( lhs, rhs ); } \
+		template<typename A, typename K, std::enable_if_t<std::is_arithmetic_v<K>, int> = 0> \
+		inline Relation<A, Op> operator op( const Sum<A>& lhs, K rhs ) { return make_relation<Op>( lhs, rhs ); } \
+		template<typename A, typename K, std::enable_if_t<std::is_arithmetic_v<K>, int> = 0> \
+		inline Relation<A, FlippedOp> operator op( K lhs, const Sum<A>& rhs ) { return make_relation<FlippedOp>( rhs, lhs ); }
+
+		GHOST_EXPR_RELATION( <=, LessEqual, GreaterEqual )
+		GHOST_EXPR_RELATION( <, Less, Greater )
+		GHOST_EXPR_RELATION( >=, GreaterEqual, LessEqual )
+		GHOST_EXPR_RELATION( >, Greater, Less )
+		GHOST_EXPR_RELATION( ==, Equal, Equal )
+		GHOST_EXPR_RELATION( !=, NotEqual, NotEqual )
+
+#undef GHOST_EXPR_RELATION
+
+		/*!
+		 * Constraint generated from a Relation by make_constraint. Its error is computed by
+		 * Op::error( sum, rhs ), where the current sum is maintained incrementally, and all
+		 * element-wise computations are inlined.
+		 */
+		template<typename E, typename Op>
+		class CompiledConstraint final : public Constraint
+		{
+			using value_type = typename Sum<E>::value_type;
+
+			E _term;
+			double _offset;
+			double _rhs;
+			mutable value_type _current_sum;
+
+			inline double compute_error( value_type sum ) const { return Op::error( static_cast<double>( sum ) + _offset, _rhs ); }
+
+			double required_error( const std::vector<Variable*>& variables ) const override
+			{
+				_current_sum = value_type{};
+				for( int i = 0 ; i < static_cast<int>( variables.size() ) ; ++i )
+					_current_sum += _term.at( i, variables[i]->get_value() );
+
+				return compute_error( _current_sum );
+			}
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override
+			{
+				value_type sum = _current_sum;
+				for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+				{
+					int index = variable_indexes[i];
+					sum += _term.at( index, candidate_values[i] ) - _term.at( index, variables[ index ]->get_value() );
+				}
+
+				return compute_error( sum ) - get_current_error();
+			}
+
+			std::vector<double> optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+			                                                    int variable_index,
+			                                                    const std::vector<int>& candidate_values ) const override
+			{
+				value_type partial_sum = _current_sum - _term.at( variable_index, variables[ variable_index ]->get_value() );
+				double current_error = get_current_error();
+
+				std::vector<double> deltas( candidate_values.size() );
+				for( int i = 0 ; i < static_cast<int>( candidate_values.size() ) ; ++i )
+					deltas[i] = compute_error( partial_sum + _term.at( variable_index, candidate_values[i] ) ) - current_error;
+
+				return deltas;
+			}
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value ) override
+			{
+				_current_sum += _term.at( variable_index, new_value ) - _term.at( variable_index, variables[ variable_index ]->get_value() );
+			}
+
+		public:
+			explicit CompiledConstraint( const Relation<E, Op>& relation )
+				: Constraint( *relation.lhs.get_term().scope() ),
+				  _term( relation.lhs.get_term() ),
+				  _offset( relation.lhs.get_offset() ),
+				  _rhs( relation.rhs ),
+				  _current_sum( value_type{} )
+			{ }
+		};
+
+		//! Build the constraint corresponding to the given relation, like sum( w * x ) <= 15.
+		template<typename E, typename Op>
+		inline std::shared_ptr<CompiledConstraint<E, Op>> make_constraint( const Relation<E, Op>& relation )
+		{
+			return std::make_shared<CompiledConstraint<E, Op>>( relation );
+		}
+	}
+}
@@ -52,11 +52,25 @@ namespace ghost
 			double optional_delta_error( const std::vector<Variable*>& variables,
 			                             const std::vector<int>& variable_indexes,
 			                             const std::vector<int>& candidate_values ) const override;
+
+			std::vector<double> optional_batch_error( const std::vector<Variable*>& variables,
+			                                         const std::vector<int>& values,
+			                                         int number_samples ) const override;
+
+			std::vector<int> optional_plausible_values( const std::vector<Variable*>& variables,
+			                                            int variable_index,
+			                                            const std::vector<int>& candidate_values ) const override;
 			
 			void conditional_update_data_structures( const std::vector<Variable*>& variables,
 			                                         int variable_index,
 			                                         int new_value ) override;
 
+			bool optional_is_permutation_invariant( const std::vector<Variable*>& variables ) const override;
+
+			std::size_t optional_memory_usage( const std::vector<Variable*>& variables ) const override;
+
+			bool optional_can_merge( const std::vector<Variable*>& variables, int index_1, int index_2 ) const override;
+
 			double binomial_with_2( int value ) const;
 
 		public:
@@ -0,0 +1,143 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <memory>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Bin Packing constraint: each variable is an item with a weight, taking as value
+		 * the index of its bin in [0, B-1]. The sum of the weights of the items in each bin must not exceed the
+		 * bin capacity.
+		 * See http://sofdem.github.io/gccat/gccat/Cbin_packing_capa.html
+		 *
+		 * The error is the sum over all bins of their load exceeding their capacity. Items with a value outside
+		 * [0, B-1] are not packed, and their weight is added to the error.
+		 *
+		 * Loads of bins are kept up to date, so moving an item from a bin to another is evaluated in O(1),
+		 * and all candidate bins of an item are evaluated in O(B).
+		 */
+		class BinPacking : public Constraint
+		{
+			std::vector<double> _weights;
+			std::vector<double> _capacities;
+
+			mutable std::vector<double> _loads;
+			mutable double _unpacked_load;
+
+			// Add 'weight' to the load of the bin, and return the resulting variation of the error.
+			inline double add_to_bin( int bin, double weight ) const
+			{
+				if( bin < 0 || bin >= static_cast<int>( _loads.size() ) )
+				{
+					_unpacked_load += weight;
+					return weight;
+				}
+
+				double diff = std::max( 0.0, _loads[ bin ] + weight - _capacities[ bin ] ) - std::max( 0.0, _loads[ bin ] - _capacities[ bin ] );
+				_loads[ bin ] += weight;
+				return diff;
+			}
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			std::vector<double> optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+			                                                    int variable_index,
+			                                                    const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+			bool optional_can_merge( const std::vector<Variable*>& variables, int index_1, int index_2 ) const override;
+
+			std::shared_ptr<Constraint> optional_coarsen( const std::vector<Variable*>& variables,
+			                                              const std::vector<int>& coarse_variables_index ) const override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint.
+			 * \param weights the vector of weights of each item, i.e., of each variable.
+			 * \param capacities the vector of capacities of each bin. Its size gives the number of bins.
+			 */
+			BinPacking( const std::vector<int>& variables_index,
+			            const std::vector<double>& weights,
+			            const std::vector<double>& capacities );
+
+			/*!
+			 * Constructor with a vector of variable IDs. This constructor calls BinPacking( const std::vector<int>& variables_index, const std::vector<double>& weights, const std::vector<double>& capacities ), with all bins having the same capacity.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint.
+			 * \param weights the vector of weights of each item, i.e., of each variable.
+			 * \param number_bins the number of bins.
+			 * \param capacity the capacity of each bin.
+			 */
+			BinPacking( const std::vector<int>& variables_index,
+			            const std::vector<double>& weights,
+			            int number_bins,
+			            double capacity );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint.
+			 * \param weights the vector of weights of each item, i.e., of each variable.
+			 * \param capacities the vector of capacities of each bin. Its size gives the number of bins.
+			 */
+			BinPacking( const std::vector<Variable>& variables,
+			            const std::vector<double>& weights,
+			            const std::vector<double>& capacities );
+
+			/*!
+			 * Constructor with a vector of variable. This constructor calls BinPacking( const std::vector<Variable>& variables, const std::vector<double>& weights, const std::vector<double>& capacities ), with all bins having the same capacity.
+			 * \param variables a const reference to a vector of variables composing the constraint.
+			 * \param weights the vector of weights of each item, i.e., of each variable.
+			 * \param number_bins the number of bins.
+			 * \param capacity the capacity of each bin.
+			 */
+			BinPacking( const std::vector<Variable>& variables,
+			            const std::vector<double>& weights,
+			            int number_bins,
+			            double capacity );
+		};
+	}
+}
@@ -0,0 +1,101 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Circuit constraint over successor variables: the i-th variable of the
+		 * constraint takes the (local) position of its successor in the constraint scope, i.e., a value in
+		 * [0, n-1] where n is the number of variables. The constraint is satisfied if successors
+		 * form a single Hamiltonian circuit.
+		 * See http://sofdem.github.io/gccat/gccat/Ccircuit.html
+		 *
+		 * The error is the number of nodes without predecessor, plus the number of extra connected components
+		 * of the successor graph. If values form a permutation, this is the number of extra cycles.
+		 *
+		 * When values form a permutation, which is always the case in permutation problems, the error
+		 * variation of a swap or a single value change is computed in O(1) thanks to a cycle labeling of
+		 * nodes, recomputed in O(n) only after a move has been done. Otherwise, delta errors are computed in
+		 * almost linear time by a union-find over the successor graph.
+		 */
+		class Circuit : public Constraint
+		{
+			mutable std::vector<int> _successors;
+			mutable std::vector<int> _in_degrees;
+			mutable int _nodes_without_predecessor;
+
+			mutable std::vector<int> _cycles; // Cycle label of each node, valid only if successors form a permutation.
+			mutable bool _cycles_outdated;
+
+			// Error of the given successor graph, computed from scratch.
+			double compute_error( const std::vector<int>& successors ) const;
+
+			// Label nodes with their cycle, if needed. Must be called only if successors form a permutation.
+			void update_cycles() const;
+
+			inline bool is_node( int value ) const
+			{
+				return value >= 0 && value < static_cast<int>( _successors.size() );
+			}
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint.
+			 */
+			Circuit( const std::vector<int>& variables_index );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint.
+			 */
+			Circuit( const std::vector<Variable>& variables );
+		};
+	}
+}
@@ -0,0 +1,102 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Cumulative constraint, where each variable in the scope is the
+		 * starting time of a task.
+		 * See http://sofdem.github.io/gccat/gccat/Ccumulative.html
+		 *
+		 * The error is the overload area of the resource profile, i.e., the sum over all time
+		 * points of the resource consumption exceeding the capacity. The load profile is kept
+		 * up to date incrementally, so moving one task costs O(duration).
+		 */
+		class Cumulative : public Constraint
+		{
+			std::vector<int> _durations;
+			std::vector<int> _demands;
+			int _capacity;
+
+			mutable std::vector<int> _load; // Resource consumption at each time point of the horizon.
+			mutable int _horizon_start; // Time point corresponding to _load[0].
+
+			// Add demand to the resource profile for each time point in [start, start + duration),
+			// and return the resulting variation of the overload area.
+			double add_to_profile( int start, int duration, int demand ) const;
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint,
+			 * each variable being the starting time of a task.
+			 * \param durations the vector of task durations, one per variable.
+			 * \param demands the vector of task resource demands, one per variable.
+			 * \param capacity the resource capacity that must not be exceeded at any time point.
+			 */
+			Cumulative( const std::vector<int>& variables_index,
+			            const std::vector<int>& durations,
+			            const std::vector<int>& demands,
+			            int capacity );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint,
+			 * each variable being the starting time of a task.
+			 * \param durations the vector of task durations, one per variable.
+			 * \param demands the vector of task resource demands, one per variable.
+			 * \param capacity the resource capacity that must not be exceeded at any time point.
+			 */
+			Cumulative( const std::vector<Variable>& variables,
+			            const std::vector<int>& durations,
+			            const std::vector<int>& demands,
+			            int capacity );
+		};
+	}
+}
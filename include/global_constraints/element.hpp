@@ -0,0 +1,101 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Element constraint: given an array of integers, a value variable y and an index variable x,
+		 * the constraint is satisfied if y = array[x], with array indexes starting from 0.
+		 * See http://sofdem.github.io/gccat/gccat/Celement.html
+		 *
+		 * The error is |array[x] - y| if x is a valid index. Otherwise, x is considered to be the closest valid index,
+		 * and its distance to that index is added to the error.
+		 *
+		 * Delta errors are computed in O(1), and all candidate values of a variable are evaluated in a single
+		 * loop over the candidates, that compilers can vectorize.
+		 */
+		class Element : public Constraint
+		{
+			std::vector<int> _array;
+
+			inline double compute_error( int index, int value ) const
+			{
+				int valid_index = std::clamp( index, 0, static_cast<int>( _array.size() ) - 1 );
+				return std::abs( _array[ valid_index ] - value ) + std::abs( index - valid_index );
+			}
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			std::vector<double> optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+			                                                    int variable_index,
+			                                                    const std::vector<int>& candidate_values ) const override;
+
+		public:
+			//! Exception thrown by constructors when the array is empty.
+			struct emptyArrayException : std::exception
+			{
+				const char* what() const noexcept { return "Element constraints need a non-empty array.\n"; }
+			};
+
+			/*!
+			 * Constructor with variable IDs.
+			 * \param index_variable the ID of the index variable x.
+			 * \param value_variable the ID of the value variable y.
+			 * \param array a non-empty vector of integers such that y = array[x].
+			 * \exception emptyArrayException if the array is empty.
+			 */
+			Element( int index_variable, int value_variable, const std::vector<int>& array );
+
+			/*!
+			 * Constructor with variables.
+			 * \param index_variable a const reference to the index variable x.
+			 * \param value_variable a const reference to the value variable y.
+			 * \param array a non-empty vector of integers such that y = array[x].
+			 * \exception emptyArrayException if the array is empty.
+			 */
+			Element( const Variable& index_variable, const Variable& value_variable, const std::vector<int>& array );
+		};
+	}
+}
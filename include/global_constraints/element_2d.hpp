@@ -0,0 +1,117 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <string>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Element constraint over a matrix: given a matrix of integers, a value variable y and two
+		 * index variables r and c, the constraint is satisfied if y = matrix[r][c], with indexes starting from 0.
+		 * See http://sofdem.github.io/gccat/gccat/Celement_matrix.html
+		 *
+		 * The error is |matrix[r][c] - y| if r and c are valid indexes. Otherwise, they are considered to be the
+		 * closest valid indexes, and their distance to these indexes is added to the error.
+		 *
+		 * Delta errors are computed in O(1), and all candidate values of a variable are evaluated in a single
+		 * loop over the candidates.
+		 */
+		class Element2D : public Constraint
+		{
+			std::vector<int> _matrix; // flattened, row by row
+			int _number_rows;
+			int _number_columns;
+
+			inline double compute_error( int row, int column, int value ) const
+			{
+				int valid_row = std::clamp( row, 0, _number_rows - 1 );
+				int valid_column = std::clamp( column, 0, _number_columns - 1 );
+				return std::abs( _matrix[ valid_row * _number_columns + valid_column ] - value )
+					+ std::abs( row - valid_row )
+					+ std::abs( column - valid_column );
+			}
+
+			// Store the matrix row by row, checking it is not empty and all its rows have the same size.
+			void flatten( const std::vector<std::vector<int>>& matrix );
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			std::vector<double> optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+			                                                    int variable_index,
+			                                                    const std::vector<int>& candidate_values ) const override;
+
+		public:
+			//! Exception thrown by constructors when the matrix is empty, or when its rows have different sizes.
+			struct matrixException : std::exception
+			{
+				std::string message;
+				matrixException( const std::string& message ) : message( message ) {}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			/*!
+			 * Constructor with variable IDs.
+			 * \param row_variable the ID of the row index variable r.
+			 * \param column_variable the ID of the column index variable c.
+			 * \param value_variable the ID of the value variable y.
+			 * \param matrix a non-empty matrix of integers, given as a vector of rows of the same size, such that y = matrix[r][c].
+			 * \exception matrixException if the matrix is empty or its rows have different sizes.
+			 */
+			Element2D( int row_variable, int column_variable, int value_variable, const std::vector<std::vector<int>>& matrix );
+
+			/*!
+			 * Constructor with variables.
+			 * \param row_variable a const reference to the row index variable r.
+			 * \param column_variable a const reference to the column index variable c.
+			 * \param value_variable a const reference to the value variable y.
+			 * \param matrix a non-empty matrix of integers, given as a vector of rows of the same size, such that y = matrix[r][c].
+			 * \exception matrixException if the matrix is empty or its rows have different sizes.
+			 */
+			Element2D( const Variable& row_variable,
+			           const Variable& column_variable,
+			           const Variable& value_variable,
+			           const std::vector<std::vector<int>>& matrix );
+		};
+	}
+}
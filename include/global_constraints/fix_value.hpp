@@ -53,6 +53,9 @@ namespace ghost
 			double optional_delta_error( const std::vector<Variable*>& variables,
 			                             const std::vector<int>& variable_indexes,
 			                             const std::vector<int>& candidate_values ) const override;
+			std::vector<double> optional_batch_error( const std::vector<Variable*>& variables,
+			                                         const std::vector<int>& values,
+			                                         int number_samples ) const override;
 	
 		public:
 			/*!
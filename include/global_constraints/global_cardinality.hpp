@@ -0,0 +1,172 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include <unordered_map>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Global Cardinality constraint with lower and upper bounds on the number
+		 * of occurrences of each given value.
+		 * See http://sofdem.github.io/gccat/gccat/Cglobal_cardinality_low_up.html
+		 *
+		 * The error is the sum, over all given values, of the number of missing occurrences below
+		 * the lower bound and the number of exceeding occurrences above the upper bound. Variables
+		 * taking values that are not given to the constraint do not count.
+		 *
+		 * The number of occurrences of each value is kept up to date, in a dense array if given values
+		 * are close enough to each other, so delta errors of a value change or a swap are computed in O(1).
+		 */
+		class GlobalCardinality : public Constraint
+		{
+			std::vector<int> _lower_bounds;
+			std::vector<int> _upper_bounds;
+
+			// To know the slot of each given value in _counts.
+			// _dense_slots is used if given values are dense enough, _sparse_slots otherwise.
+			int _min_value;
+			std::vector<int> _dense_slots;
+			std::unordered_map<int,int> _sparse_slots;
+
+			mutable std::vector<int> _counts; // Number of occurrences of each given value.
+
+			void initialize_slots( const std::vector<int>& values );
+
+			// Return the slot of the value in _counts, or -1 if the value does not count.
+			inline int slot( int value ) const
+			{
+				if( !_dense_slots.empty() )
+				{
+					if( value < _min_value || value - _min_value >= static_cast<int>( _dense_slots.size() ) )
+						return -1;
+					return _dense_slots[ value - _min_value ];
+				}
+				else
+				{
+					auto iterator = _sparse_slots.find( value );
+					return iterator == _sparse_slots.end() ? -1 : iterator->second;
+				}
+			}
+
+			// Error of a slot if its value occurs 'count' times.
+			inline double slot_error( int slot, int count ) const
+			{
+				return std::max( 0, _lower_bounds[ slot ] - count ) + std::max( 0, count - _upper_bounds[ slot ] );
+			}
+
+			// Add 'occurrences' to the count of the slot, and return the resulting variation of the error.
+			inline double add_to_count( int slot, int occurrences ) const
+			{
+				if( slot == -1 )
+					return 0.0;
+
+				double diff = slot_error( slot, _counts[ slot ] + occurrences ) - slot_error( slot, _counts[ slot ] );
+				_counts[ slot ] += occurrences;
+				return diff;
+			}
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			std::vector<double> optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+			                                                    int variable_index,
+			                                                    const std::vector<int>& candidate_values ) const override;
+
+			std::vector<int> optional_plausible_values( const std::vector<Variable*>& variables,
+			                                            int variable_index,
+			                                            const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+			bool optional_is_permutation_invariant( const std::vector<Variable*>& variables ) const override;
+
+			std::size_t optional_memory_usage( const std::vector<Variable*>& variables ) const override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint.
+			 * \param values the vector of (distinct) values to count.
+			 * \param lower_bounds the minimal number of occurrences of each value in 'values'.
+			 * \param upper_bounds the maximal number of occurrences of each value in 'values'.
+			 */
+			GlobalCardinality( const std::vector<int>& variables_index,
+			                   const std::vector<int>& values,
+			                   const std::vector<int>& lower_bounds,
+			                   const std::vector<int>& upper_bounds );
+
+			/*!
+			 * Constructor with a vector of variable IDs. This constructor calls GlobalCardinality( const std::vector<int>& variables_index, const std::vector<int>& values, const std::vector<int>& lower_bounds, const std::vector<int>& upper_bounds ), with lower and upper bounds both set to 'counts'.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint.
+			 * \param values the vector of (distinct) values to count.
+			 * \param counts the exact number of occurrences of each value in 'values'.
+			 */
+			GlobalCardinality( const std::vector<int>& variables_index,
+			                   const std::vector<int>& values,
+			                   const std::vector<int>& counts );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint.
+			 * \param values the vector of (distinct) values to count.
+			 * \param lower_bounds the minimal number of occurrences of each value in 'values'.
+			 * \param upper_bounds the maximal number of occurrences of each value in 'values'.
+			 */
+			GlobalCardinality( const std::vector<Variable>& variables,
+			                   const std::vector<int>& values,
+			                   const std::vector<int>& lower_bounds,
+			                   const std::vector<int>& upper_bounds );
+
+			/*!
+			 * Constructor with a vector of variable. This constructor calls GlobalCardinality( const std::vector<Variable>& variables, const std::vector<int>& values, const std::vector<int>& lower_bounds, const std::vector<int>& upper_bounds ), with lower and upper bounds both set to 'counts'.
+			 * \param variables a const reference to a vector of variables composing the constraint.
+			 * \param values the vector of (distinct) values to count.
+			 * \param counts the exact number of occurrences of each value in 'values'.
+			 */
+			GlobalCardinality( const std::vector<Variable>& variables,
+			                   const std::vector<int>& values,
+			                   const std::vector<int>& counts );
+		};
+	}
+}
@@ -0,0 +1,118 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <memory>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Graph Coloring constraint, i.e., a conjunction of Not Equal constraints
+		 * over the edges of a graph: variables of the constraint are vertices, their value is their color,
+		 * and two adjacent vertices must have different colors.
+		 * See http://sofdem.github.io/gccat/gccat/Cneq.html
+		 *
+		 * The error is the number of edges with both vertices having the same color.
+		 *
+		 * This constraint should be preferred to one ghost::Constraint object per edge. The graph is stored
+		 * in a compressed adjacency structure (CSR), and for each vertex and each color, the number of neighbors
+		 * having this color is kept up to date. Delta errors of recoloring a vertex are computed in O(1),
+		 * and updates after a move are done in O(degree).
+		 */
+		class GraphDifferent : public Constraint
+		{
+			std::vector<int> _offsets; // neighbors of vertex v are in _neighbors[ _offsets[v] .. _offsets[v+1] - 1 ]
+			std::vector<int> _neighbors;
+
+			mutable int _min_color;
+			mutable int _number_colors;
+			mutable std::vector<int> _color_counts; // _color_counts[ v * _number_colors + c ]: number of neighbors of v having the color c + _min_color
+
+			inline int& color_count( int vertex, int color ) const
+			{
+				return _color_counts[ vertex * _number_colors + color - _min_color ];
+			}
+
+			// Change the color of vertex in neighbor tables
+			inline void recolor( int vertex, int old_color, int new_color ) const
+			{
+				for( int neighbor = _offsets[ vertex ] ; neighbor < _offsets[ vertex + 1 ] ; ++neighbor )
+				{
+					--color_count( _neighbors[ neighbor ], old_color );
+					++color_count( _neighbors[ neighbor ], new_color );
+				}
+			}
+
+			void build_adjacency( int number_vertices, const std::vector<std::pair<int,int>>& edges );
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			std::vector<double> optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+			                                                    int variable_index,
+			                                                    const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+			bool optional_can_merge( const std::vector<Variable*>& variables, int index_1, int index_2 ) const override;
+
+			std::shared_ptr<Constraint> optional_coarsen( const std::vector<Variable*>& variables,
+			                                              const std::vector<int>& coarse_variables_index ) const override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint, i.e., the vertices.
+			 * \param edges the vector of edges of the graph, each edge being a pair of vertex positions in variables_index. Self-loops are ignored.
+			 */
+			GraphDifferent( const std::vector<int>& variables_index, const std::vector<std::pair<int,int>>& edges );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint, i.e., the vertices.
+			 * \param edges the vector of edges of the graph, each edge being a pair of vertex positions in variables. Self-loops are ignored.
+			 */
+			GraphDifferent( const std::vector<Variable>& variables, const std::vector<std::pair<int,int>>& edges );
+		};
+	}
+}
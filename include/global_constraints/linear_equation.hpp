@@ -30,6 +30,7 @@
 #pragma once
 
 #include <vector>
+#include <memory>
 
 #include "../variable.hpp"
 #include "../constraint.hpp"
@@ -43,6 +44,9 @@ namespace ghost
 		 */
 		class LinearEquation : public Constraint
 		{
+			// Linear equation of a coarse model (see Options::multilevel), sharing the error function of the equation it coarsens.
+			class Coarse;
+
 			std::vector<double> _coefficients;
 			mutable double _current_sum;
 
@@ -74,8 +78,18 @@ namespace ghost
 			                             const std::vector<int>& variable_indexes,
 			                             const std::vector<int>& candidate_values ) const override;
 
+			std::vector<double> optional_batch_error( const std::vector<Variable*>& variables,
+			                                         const std::vector<int>& values,
+			                                         int number_samples ) const override;
+
 			void conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_id, int new_value ) override;
 
+			bool optional_is_permutation_invariant( const std::vector<Variable*>& variables ) const override;
+
+			std::size_t optional_memory_usage( const std::vector<Variable*>& variables ) const override;
+
+			std::shared_ptr<Constraint> optional_coarsen( const std::vector<Variable*>& variables,
+			                                              const std::vector<int>& coarse_variables_index ) const override;
 		};
 	}
 }
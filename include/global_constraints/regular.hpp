@@ -0,0 +1,136 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <tuple>
+#include <unordered_map>
+#include <limits>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Regular constraint: the sequence of values taken by variables, in the order of the
+		 * constraint scope, must be a word recognized by a given finite automaton.
+		 * See http://sofdem.github.io/gccat/gccat/Cautomaton.html
+		 *
+		 * The error is the minimal number of variables to change to get a recognized word, where changed variables
+		 * can take any symbol of the automaton. If the automaton recognizes no word of the scope length,
+		 * the error is the scope length plus one.
+		 *
+		 * This error is computed by dynamic programming, keeping for each position the minimal number of changes
+		 * to reach each state from the initial state (forward table), and to reach an accepting state from each
+		 * state (backward table). After a move, only table rows depending on the changed variable are recomputed,
+		 * lazily. Changing the value of one variable is then evaluated in O(|Q|) from the cached rows, and
+		 * changing several variables in O(d.|T|), d being the distance between the first and the last changed
+		 * variable and |T| the number of transitions.
+		 */
+		class Regular : public Constraint
+		{
+			static constexpr int UNREACHABLE = std::numeric_limits<int>::max() / 4;
+
+			int _number_states;
+			int _initial_state;
+			std::vector<bool> _accepting_states;
+			std::vector<std::tuple<int,int,int>> _transitions; // (from, symbol, to)
+			std::unordered_map<int, std::vector<std::pair<int,int>>> _transitions_by_symbol; // symbol -> (from, to)
+
+			mutable std::vector<int> _word;
+			mutable std::vector<int> _forward; // row i: minimal changes on the first i symbols to reach each state
+			mutable std::vector<int> _backward; // row i: minimal changes on symbols from i to accept from each state
+			mutable int _forward_valid_up_to; // forward rows [0, _forward_valid_up_to] are up to date
+			mutable int _backward_valid_from; // backward rows [_backward_valid_from, n] are up to date
+			mutable std::vector<int> _change_costs; // minimal changes if the symbol at each position is changed, -1 if outdated
+
+			inline int* forward_row( int position ) const { return _forward.data() + position * _number_states; }
+			inline int* backward_row( int position ) const { return _backward.data() + position * _number_states; }
+
+			void forward_step( const int* row, int symbol, int* next_row ) const;
+			void backward_step( const int* next_row, int symbol, int* row ) const;
+			void compute_forward_up_to( int position ) const;
+			void compute_backward_down_to( int position ) const;
+
+			// Minimal changes of the whole word if the symbol at 'position' is replaced by 'symbol'.
+			int cost_with( int position, int symbol ) const;
+			double to_error( int cost ) const;
+
+			void initialize( const std::vector<int>& accepting_states );
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			std::vector<double> optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+			                                                    int variable_index,
+			                                                    const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint.
+			 * \param number_states the number of states of the automaton, labeled from 0 to number_states-1.
+			 * \param initial_state the initial state of the automaton.
+			 * \param accepting_states the vector of accepting states of the automaton.
+			 * \param transitions the vector of transitions of the automaton, each one being a tuple (from state, symbol, to state).
+			 */
+			Regular( const std::vector<int>& variables_index,
+			         int number_states,
+			         int initial_state,
+			         const std::vector<int>& accepting_states,
+			         const std::vector<std::tuple<int,int,int>>& transitions );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint.
+			 * \param number_states the number of states of the automaton, labeled from 0 to number_states-1.
+			 * \param initial_state the initial state of the automaton.
+			 * \param accepting_states the vector of accepting states of the automaton.
+			 * \param transitions the vector of transitions of the automaton, each one being a tuple (from state, symbol, to state).
+			 */
+			Regular( const std::vector<Variable>& variables,
+			         int number_states,
+			         int initial_state,
+			         const std::vector<int>& accepting_states,
+			         const std::vector<std::tuple<int,int,int>>& transitions );
+		};
+	}
+}
@@ -0,0 +1,82 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace ghost
+{
+	namespace global_objectives
+	{
+		/*!
+		 * Helper class counting occurrences of integer values within a known range, and keeping
+		 * track of their maximum. Used by ghost::global_objectives::MinimizeMax and
+		 * ghost::global_objectives::MaximizeMin.
+		 *
+		 * Adding or removing a value is done in O(1), plus the distance to the next value when the
+		 * maximum is removed. The maximum after changing one value is computed in amortized O(1).
+		 */
+		class MaxCounter
+		{
+			int _min_value;
+			std::vector<int> _counts;
+			int _max; // index in _counts of the maximal value, -1 if empty
+			mutable int _below_max; // index in _counts of the greatest value lower than the maximal one, -1 if none
+			mutable bool _below_max_outdated;
+
+			// Index of the greatest value with an index lower than or equal to 'index', -1 if none.
+			int greatest_from( int index ) const;
+
+		public:
+			MaxCounter();
+
+			//! Clear the counter and set the range of values to [min_value, max_value].
+			void reset( int min_value, int max_value );
+
+			//! Inline method returning true if reset has been called at least once.
+			inline bool is_initialized() const { return !_counts.empty(); }
+
+			//! Add one occurrence of value.
+			void add( int value );
+
+			//! Remove one occurrence of value.
+			void remove( int value );
+
+			//! Inline method returning the maximal value. The counter must not be empty.
+			inline int max() const { return _max + _min_value; }
+
+			//! Maximal value if one occurrence of old_value is replaced by new_value.
+			int max_after_change( int old_value, int new_value ) const;
+
+			//! Maximal value if occurrences of old_values are replaced by new_values. The counter is left unchanged.
+			int max_after_changes( const std::vector<int>& old_values, const std::vector<int>& new_values );
+		};
+	}
+}
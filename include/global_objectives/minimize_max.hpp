@@ -0,0 +1,92 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "../variable.hpp"
+#include "../objective.hpp"
+#include "max_counter.hpp"
+
+namespace ghost
+{
+	namespace global_objectives
+	{
+		/*!
+		 * Objective function minimizing the maximal value among its variables, possibly shifted by
+		 * variable-specific offsets: for instance, minimizing the makespan of tasks, given their starting time
+		 * and their duration as offsets.
+		 *
+		 * The number of occurrences of each shifted value is kept up to date, so the variation of the maximum
+		 * after a move is computed in O(1) for a single variable change, without scanning all variables.
+		 */
+		class MinimizeMax : public Minimize
+		{
+			std::vector<int> _offsets;
+			mutable MaxCounter _counter; // counting shifted values
+
+			double required_cost( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_cost( const std::vector<Variable*>& variables,
+			                            const std::vector<int>& variable_indexes,
+			                            const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables, int index, int new_value ) override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by Objective
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the objective function.
+			 */
+			MinimizeMax( const std::vector<int>& variables_index );
+
+			/*!
+			 * Constructor with a vector of variable IDs and offsets.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the objective function.
+			 * \param offsets the vector of offsets added to the value of each variable.
+			 */
+			MinimizeMax( const std::vector<int>& variables_index, const std::vector<int>& offsets );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the objective function.
+			 */
+			MinimizeMax( const std::vector<Variable>& variables );
+
+			/*!
+			 * Constructor with a vector of variable and offsets.
+			 * \param variables a const reference to a vector of variables composing the objective function.
+			 * \param offsets the vector of offsets added to the value of each variable.
+			 */
+			MinimizeMax( const std::vector<Variable>& variables, const std::vector<int>& offsets );
+		};
+	}
+}
@@ -37,3 +37,48 @@
 #else
 #define COUT std::cout
 #endif
+
+// Static tracepoints (USDT) of the provider 'ghost', for tracers like bpftrace or perf.
+// They are compiled out if sys/sdt.h is not available. See tools/*.bt for examples.
+// All arguments are integers, since tracers like bpftrace cannot read floating-point numbers.
+// Errors and costs are passed through GHOST_PROBE_ERROR, in thousandths: an error of 2.5 is read as 2500.
+// Probes and arguments:
+//   solve_start( number_variables, timeout in microseconds ), solve_end( solution_found, wall-clock time in microseconds )
+//     (also fired by Solver::begin, with a timeout of 0, and Solver::end, with the time since Solver::begin)
+//   iteration_start( search_iterations ), new_best( search_iterations, best_sat_error, best_opt_cost )
+//   move( variable, value or swapped variable, error delta ), compound_move( variable, number of changed variables, error delta )
+//   plateau( variable ), local_minimum( variable ), reset( resets ), restart( restarts )
+#if __has_include( <sys/sdt.h> )
+#include <sys/sdt.h>
+#include <cmath>
+#include <limits>
+
+namespace ghost
+{
+	// Error or cost in thousandths, rounded to the nearest integer and clamped to the range of long long
+	// (best_opt_cost is std::numeric_limits<double>::max() until a solution is found). NaN is passed as 0.
+	inline long long probe_error( double error )
+	{
+		constexpr double bound = static_cast<double>( std::numeric_limits<long long>::max() ) / 1000;
+		if( std::isnan( error ) )
+			return 0;
+		if( error >= bound )
+			return std::numeric_limits<long long>::max();
+		if( error <= -bound )
+			return std::numeric_limits<long long>::min();
+		return std::llround( error * 1000 );
+	}
+}
+
+#define GHOST_PROBE_ERROR( error ) ghost::probe_error( error )
+#define GHOST_PROBE( name ) DTRACE_PROBE( ghost, name )
+#define GHOST_PROBE1( name, arg1 ) DTRACE_PROBE1( ghost, name, arg1 )
+#define GHOST_PROBE2( name, arg1, arg2 ) DTRACE_PROBE2( ghost, name, arg1, arg2 )
+#define GHOST_PROBE3( name, arg1, arg2, arg3 ) DTRACE_PROBE3( ghost, name, arg1, arg2, arg3 )
+#else
+#define GHOST_PROBE_ERROR( error ) static_cast<void>( 0 )
+#define GHOST_PROBE( name ) static_cast<void>( 0 )
+#define GHOST_PROBE1( name, arg1 ) static_cast<void>( 0 )
+#define GHOST_PROBE2( name, arg1, arg2 ) static_cast<void>( 0 )
+#define GHOST_PROBE3( name, arg1, arg2, arg3 ) static_cast<void>( 0 )
+#endif
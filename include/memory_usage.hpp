@@ -0,0 +1,128 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ghost
+{
+	/*!
+	 * MemoryUsage is a breakdown of the memory taken by the data structures of a Model, a
+	 * SearchUnit or a Solver, in bytes.
+	 *
+	 * These are estimations: containers are counted by their capacity, and map nodes by the
+	 * size of their elements plus their pointers, without the overhead of the memory allocator.
+	 * The static methods heap_bytes can be used to report the memory taken by data structures
+	 * of user-defined constraints (see Constraint::optional_memory_usage).
+	 *
+	 * \sa Model, Solver
+	 */
+	class MemoryUsage final
+	{
+		std::map<std::string, std::size_t> _breakdown;
+
+	public:
+		/*!
+		 * Add some bytes to a data structure of the breakdown. Nothing is added if bytes equals 0.
+		 *
+		 * \param structure a const reference of the name of the data structure.
+		 * \param bytes the number of bytes to add.
+		 */
+		void add( const std::string& structure, std::size_t bytes );
+
+		/*!
+		 * Add the breakdown of another MemoryUsage object, with data structures prefixed by
+		 * 'prefix / '.
+		 *
+		 * \param prefix a const reference of the string prefixing the data structures of 'other'.
+		 * \param other a const reference of the MemoryUsage object to add.
+		 */
+		void add( const std::string& prefix, const MemoryUsage& other );
+
+		//! Return the number of bytes of a data structure, 0 if it does not appear in the breakdown.
+		std::size_t get( const std::string& structure ) const;
+
+		//! Return the number of bytes of all data structures.
+		std::size_t total() const;
+
+		//! Inline method returning the breakdown, from data structure names to their number of bytes.
+		inline const std::map<std::string, std::size_t>& get_breakdown() const { return _breakdown; }
+
+		//! Heap memory owned by a vector.
+		template<typename T> static std::size_t heap_bytes( const std::vector<T>& vector )
+		{
+			return vector.capacity() * sizeof( T );
+		}
+
+		//! Heap memory owned by a vector of bits.
+		static std::size_t heap_bytes( const std::vector<bool>& vector )
+		{
+			return ( vector.capacity() + 7 ) / 8;
+		}
+
+		//! Heap memory owned by a vector of vectors, including inner vectors.
+		template<typename T> static std::size_t heap_bytes( const std::vector<std::vector<T>>& vectors )
+		{
+			std::size_t bytes = vectors.capacity() * sizeof( std::vector<T> );
+			for( const auto& vector : vectors )
+				bytes += heap_bytes( vector );
+			return bytes;
+		}
+
+		//! Heap memory owned by a map: one node per element, with three pointers and a color.
+		template<typename Key, typename Value> static std::size_t heap_bytes( const std::map<Key, Value>& map )
+		{
+			return map.size() * ( sizeof( std::pair<const Key, Value> ) + 4 * sizeof( void* ) );
+		}
+
+		//! Heap memory owned by an unordered map: one node per element with a pointer, and the buckets.
+		template<typename Key, typename Value> static std::size_t heap_bytes( const std::unordered_map<Key, Value>& map )
+		{
+			return map.size() * ( sizeof( std::pair<const Key, Value> ) + sizeof( void* ) ) + map.bucket_count() * sizeof( void* );
+		}
+
+		//! Heap memory owned by a string, 0 if its characters are stored in the string object itself.
+		static std::size_t heap_bytes( const std::string& string );
+
+		//! To have a nicer stream of MemoryUsage.
+		friend std::ostream& operator<<( std::ostream& os, const MemoryUsage& memory_usage )
+		{
+			for( const auto& [ structure, bytes ] : memory_usage._breakdown )
+				os << structure << ": " << bytes << " bytes\n";
+			return os << "Total: " << memory_usage.total() << " bytes\n";
+		}
+	};
+}
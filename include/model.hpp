@@ -37,6 +37,7 @@
 #include "constraint.hpp"
 #include "objective.hpp"
 #include "auxiliary_data.hpp"
+#include "memory_usage.hpp"
 
 namespace ghost
 {
@@ -55,5 +56,8 @@ namespace ghost
 		       const std::shared_ptr<Objective>& objective,
 		       const std::shared_ptr<AuxiliaryData>& auxiliary_data,
 		       bool permutation_problem );
+
+		// Memory taken by variables, constraints, the objective function and auxiliary data
+		MemoryUsage memory_usage() const;
 	};
 }
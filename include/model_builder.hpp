@@ -36,6 +36,13 @@
 
 namespace ghost
 {
+	namespace algorithms
+	{
+		class Multilevel;
+	}
+
+	class ConstraintChecker; // Unit test helper
+
 	/*!
 	 * This is the base class from which users need to derive their ModelBuilder class. 
 	 *
@@ -62,6 +69,8 @@ namespace ghost
 	class ModelBuilder
 	{
 		template<typename ModelBuilderType> friend class Solver;
+		friend class algorithms::Multilevel;
+		friend class ConstraintChecker;
 
 		Model build_model();
 
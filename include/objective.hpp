@@ -46,6 +46,10 @@ namespace ghost
 	{
 		class AdaptiveSearchValueHeuristic;
 		class AntidoteSearchValueHeuristic;
+		class Multilevel;
+		class ProjectedObjective;
+		class ExhaustiveSearch;
+		class Intensification;
 	}
 	
 	/*!
@@ -63,6 +67,7 @@ namespace ghost
 		template<typename ModelBuilderType> friend class Solver;
 		friend class SearchUnit;
 		friend class ModelBuilder;
+		friend struct Model;
 
 		friend class NullObjective;
 		friend class Minimize;
@@ -70,12 +75,17 @@ namespace ghost
 
 		friend class algorithms::AdaptiveSearchValueHeuristic;
 		friend class algorithms::AntidoteSearchValueHeuristic;
+		friend class algorithms::Multilevel;
+		friend class algorithms::ProjectedObjective;
+		friend class algorithms::ExhaustiveSearch;
+		friend class algorithms::Intensification;
 		
 		std::vector<Variable*> _variables; // Vector of raw pointers to variables needed to compute the objective function.
 		std::vector<int> _variables_index; // To know where are the constraint's variables in the global variable vector.
 		std::map<int,int> _variables_position; // To know where are global variables in the constraint's variables vector. 
 		bool _is_optimization;
 		bool _is_maximization;
+		mutable bool _is_optional_delta_cost_defined; // Boolean telling if optional_delta_cost() is overrided or not.
 		std::string _name; // Name of the objective object.
 
 		struct nanException : std::exception
@@ -93,6 +103,17 @@ namespace ghost
 			const char* what() const noexcept { return message.c_str(); }
 		};
 
+		struct deltaCostNotDefinedException : std::exception
+		{
+			std::string message;
+
+			deltaCostNotDefinedException()
+			{
+				message = "Objective::optional_delta_cost() has not been user-defined.\n";
+			}
+			const char* what() const noexcept { return message.c_str(); }
+		};
+
 		struct variableOutOfTheScope : std::exception
 		{
 			std::string message;
@@ -107,11 +128,21 @@ namespace ghost
 		Objective( const std::vector<int>& variables_index, bool is_maximization, const std::string& name );
 		Objective( const std::vector<Variable>& variables, bool is_maximization, const std::string& name );
 
-		inline void update( int index, int new_value ) { conditional_update_data_structures( _variables, _variables_position[ index ], new_value ); }
+		inline void update( int index, int new_value )
+		{
+			auto iterator = _variables_position.find( index );
+			if( iterator != _variables_position.end() )
+				conditional_update_data_structures( _variables, iterator->second, new_value );
+		}
 
 		// Call required_cost() on Objective::_variables after making sure the cost does not give a nan, rise an exception otherwise.
 		double cost() const;
 
+		// Call optional_delta_cost() on the variables of the objective function's scope among variables_index,
+		// after making sure the delta does not give a nan, rise an exception otherwise.
+		// Returns 0 if none of these variables are in the scope.
+		double delta_cost( const std::vector<int>& variables_index, const std::vector<int>& candidate_values ) const;
+
 		// Call expert_heuristic_value on Objective::_variables.
 		inline int heuristic_value( int variable_index, const std::vector<int>& possible_values, randutils::mt19937_rng& rng ) const
 		{ return expert_heuristic_value( _variables, _variables_position.at( variable_index ), possible_values, rng ); }
@@ -144,6 +175,42 @@ namespace ghost
 		 */
 		virtual double required_cost( const std::vector<Variable*>& variables ) const = 0;
 
+		/*!
+		 * Virtual method to compute the difference, or delta, between the current value of the
+		 * objective function and its value on a candidate assignment.
+		 *
+		 * Giving a vector of variable indexes and their respective candidate value, this methods
+		 * ouputs the difference between the value of the objective function on the candidate
+		 * assignment and its value on the current assignment in 'variables' given as input.
+		 * Like required_cost, this output is a raw value: the solver takes care of inverting
+		 * its sign for maximization problems.
+		 *
+		 * If this method is defined, the solver calls it instead of assigning candidate values
+		 * and calling required_cost for each move keeping the satisfaction error unchanged.
+		 * This can make a big difference for objective functions that are expensive to compute.
+		 *
+		 * Inner data structures used by this method must be updated in
+		 * conditional_update_data_structures, and rebuilt from scratch in required_cost:
+		 * the solver calls required_cost each time variables are (re)initialized, for instance
+		 * after a reset or a restart.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory.
+		 *
+		 * \warning DO NOT implement any side effect in this method.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the scope
+		 * of the objective function. The solver is actually calling this method with the vector of
+		 * variables that has been given to the constructor.
+		 * \param variable_indexes the vector of indexes of variables that are reassigned.
+		 * \param candidate_values the vector of their respective candidate values.
+		 * \return A double corresponding to the difference between the value of the objective
+		 * function if the solver assigns candidate values to given variables, and its current value.
+		 * \exception Throws an exception if the computed value is NaN.
+		 */
+		virtual double optional_delta_cost( const std::vector<Variable*>& variables,
+		                                    const std::vector<int>& variable_indexes,
+		                                    const std::vector<int>& candidate_values ) const;
+
 		/*!
 		 * Update user-defined data structures in the objective function.
 		 *
@@ -169,9 +236,9 @@ namespace ghost
 		 * an eventual user-defined heuristic to choose a new domain value for a variable selected
 		 * by the solver.
 		 *
-		 * The default implementation outputs the value leading to the lowest objective cost.
-		 * If two or more values lead to configurations with the same lowest cost, one of them
-		 * is randomly returned.
+		 * The default implementation outputs the value leading to the lowest objective cost,
+		 * computed with optional_delta_cost if it is defined. If two or more values lead to
+		 * configurations with the same lowest cost, one of them is randomly returned.
 		 *
 		 * Like any methods prefixed by 'expert_', users should override this method only if they
 		 * know what they are doing.
@@ -31,11 +31,17 @@
 
 #include <memory>
 #include <algorithm>
+#include <vector>
 
 #include "print.hpp"
 
 namespace ghost
 {
+	namespace algorithms
+	{
+		class Neighborhood;
+	}
+
 	/*!
 	 * Options is a structure containing all optional arguments for Solver::solve.
 	 *
@@ -55,6 +61,17 @@ namespace ghost
 		int restart_threshold; //!< Trigger a restart every 'restart_threshold' reset. Set to 0 to never trigger restarts.
 		int number_variables_to_reset; //!< Number of variables to randomly change the value at each reset.
 		int number_start_samplings; //!< Number of variable assignments the solver randomly draw, if custom_starting_point and resume_search are false.
+		double target_cost; //!< For optimization problems, stop the search as soon as a solution with an objective function value at least as good as target_cost is found (before post-processing). Also useful to give a known bound of the objective function. Set to NaN (default) to never stop on a target cost.
+		int stagnation_iterations; //!< For optimization problems, stop the search if the best solution has not been improved for 'stagnation_iterations' search iterations. Set to -1 (default) to disable.
+		int stagnation_percent_budget; //!< For optimization problems, stop the search if the best solution has not been improved for 'stagnation_percent_budget'% of the time budget given to Solver::solve. Set to -1 (default) to disable.
+		std::vector<std::shared_ptr<algorithms::Neighborhood>> neighborhoods; //!< Neighborhoods of compound moves (swaps, k-exchanges, shifts or user-defined ones) explored in this order, Variable Neighborhood Descent style, when changing the selected variable does not decrease the error. Empty by default.
+		bool multilevel; //!< To enable the multilevel mode for large models: the model is coarsened by merging variables strongly connected by constraints, the coarsest model is solved first, then its solution is projected and refined level by level. Ignored for permutation problems, models with auxiliary data, and if custom_starting_point or resume_search is true. False by default.
+		int multilevel_coarsest_size; //!< In multilevel mode, stop coarsening the model when it has at most 'multilevel_coarsest_size' variables. 100 by default.
+		int multilevel_percent_budget; //!< In multilevel mode, percentage of the time budget given to coarse models. The rest of the time budget is used to refine the solution on the model itself. 25 by default.
+		bool configuration_checking; //!< To select variable candidates by configuration checking: once moved, a variable cannot be selected again before a variable sharing a constraint with it changes. Combined with the tabu list. False by default.
+		int exhaustive_search_threshold; //!< Solver::solve enumerates all variable assignments rather than running local search if the search space has at most 'exhaustive_search_threshold' assignments (the product of domain sizes, or the number of permutations for permutation problems): its result is then provably optimal, and it stops as soon as the search space is exhausted. 0 by default, disabling it.
+		int intensification_percent_budget; //!< For optimization problems, percentage of the time budget reserved to a final intensification phase: the 'intensification_top_k' best distinct solutions found by search units are improved in parallel by strict descent, exploring exhaustively moves changing the value of one variable and swaps of two variables, and the best result is kept. Set to 0 (default) to disable.
+		int intensification_top_k; //!< Number of distinct solutions improved by the final intensification phase. number_threads by default.
 
 		//! Unique constructor
 		Options();
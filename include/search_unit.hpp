@@ -32,6 +32,7 @@
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <cmath>
 #include <random>
 #include <algorithm>
 #include <vector>
@@ -55,6 +56,7 @@
 #include "algorithms/variable_candidates_heuristic.hpp"
 #include "algorithms/value_heuristic.hpp"
 #include "algorithms/error_projection_heuristic.hpp"
+#include "algorithms/neighborhood.hpp"
 
 #include "algorithms/adaptive_search_variable_heuristic.hpp"
 #include "algorithms/adaptive_search_variable_candidates_heuristic.hpp"
@@ -65,6 +67,8 @@
 #include "algorithms/antidote_search_variable_candidates_heuristic.hpp"
 #include "algorithms/antidote_search_value_heuristic.hpp"
 
+#include "algorithms/configuration_checking_variable_candidates_heuristic.hpp"
+
 #include "algorithms/culprit_search_error_projection_heuristic.hpp"
 
 #include "macros.hpp"
@@ -80,6 +84,16 @@ namespace ghost
 		std::promise<void> _stop_search_signal;
 		std::future<void> _stop_search_check;
 		std::thread::id _thread_id;
+		std::chrono::time_point<std::chrono::steady_clock> _deadline;
+		// To check the deadline and stop requests only every few calls of must_interrupt
+		int _interruption_period;
+		int _interruption_countdown;
+		std::chrono::time_point<std::chrono::steady_clock> _last_interruption_check;
+
+		// To stop optimization runs when their best solution stagnates
+		int _last_improvement_iteration;
+		std::chrono::time_point<std::chrono::steady_clock> _last_improvement_time;
+		std::chrono::duration<double,std::micro> _time_budget; // zero if unknown, i.e., for step-by-step searches
 
 #if defined GHOST_TRACE_PARALLEL
 		std::stringstream _log_filename;
@@ -129,55 +143,211 @@ namespace ghost
 		}
 #endif
 
+		// Check if the search must be interrupted, because the deadline is reached or a stop has been requested.
+		bool interruption_requested()
+		{
+			return stop_search_requested() || std::chrono::steady_clock::now() >= _deadline;
+		}
+
+		// Throttled interruption_requested, called within search iterations to bound the latency of deadlines
+		// and stop requests. It may be called for each constraint or candidate move: reading the clock and the
+		// stop future (which locks a mutex) only every few calls keeps it cheap. The period doubles, up to 64
+		// calls, while checks are less than 100us apart, and falls back to 1 as soon as they are not, such that
+		// slow constraints do not delay interruptions. Once an interruption is requested, every call checks again.
+		bool must_interrupt()
+		{
+			if( _interruption_countdown > 0 )
+			{
+				--_interruption_countdown;
+				return false;
+			}
+
+			std::chrono::time_point<std::chrono::steady_clock> now( std::chrono::steady_clock::now() );
+			if( stop_search_requested() || now >= _deadline )
+				return true;
+
+			if( now - _last_interruption_check < std::chrono::microseconds( 100 ) )
+				_interruption_period = std::min( 2 * _interruption_period, 64 );
+			else
+				_interruption_period = 1;
+
+			_last_interruption_check = now;
+			_interruption_countdown = _interruption_period - 1;
+			return false;
+		}
+
+		// Record how late the search yields after the deadline.
+		void record_deadline_overshoot()
+		{
+			std::chrono::time_point<std::chrono::steady_clock> now( std::chrono::steady_clock::now() );
+			if( now > _deadline )
+			{
+				std::chrono::duration<double,std::micro> overshoot = now - _deadline;
+				if( data.worst_deadline_overshoot < overshoot.count() )
+					data.worst_deadline_overshoot = overshoot.count();
+			}
+		}
+
+		// Record that the best candidate or solution has just been improved.
+		void record_improvement()
+		{
+			_last_improvement_iteration = data.search_iterations;
+			if( options.stagnation_percent_budget >= 0 )
+				_last_improvement_time = std::chrono::steady_clock::now();
+		}
+
+		// True iff the best solution of an optimization problem has not been improved for too long, according to
+		// options.stagnation_iterations and options.stagnation_percent_budget.
+		bool is_stagnating()
+		{
+			if( options.stagnation_iterations >= 0 && data.search_iterations - _last_improvement_iteration >= options.stagnation_iterations )
+				return true;
+
+			if( options.stagnation_percent_budget >= 0 && _time_budget.count() > 0 )
+			{
+				std::chrono::duration<double,std::micro> since_improvement = std::chrono::steady_clock::now() - _last_improvement_time;
+				if( since_improvement.count() >= _time_budget.count() * options.stagnation_percent_budget / 100 )
+					return true;
+			}
+
+			return false;
+		}
+
 		// Set the initial configuration by calling monte_carlo_sampling() 'samplings' times.
 		/*
 		 * After calling calling monte_carlo_sampling() 'samplings' times, the function keeps 
 		 * the configuration with the lowest satisfaction cost. If some of them reach 0, it keeps 
 		 * the configuration with the best optimization cost.
+		 * Samplings stop early if the search must be interrupted, after at least one sampling.
+		 * Without auxiliary data, samplings are evaluated by batches (see evaluate_samplings_by_batches).
 		 */
 		void set_initial_configuration( int samplings )
 		{
-			double best_sat_error_so_far = std::numeric_limits<double>::max();
-			double current_sat_error;
 			std::vector<int> best_values( data.number_variables, 0 );
 
 			// To avoid weird samplings numbers like 0 or -1
 			samplings = std::max( 1, samplings );
+
+			// Auxiliary data are computed from the current assignment only, so samplings must be assigned one by one
+			if( dynamic_cast<NullAuxiliaryData*>( model.auxiliary_data.get() ) == nullptr )
+			{
+				double best_sat_error_so_far = std::numeric_limits<double>::max();
+				double current_sat_error;
+				int loops = 0;
+
+				do
+				{
+					if( model.permutation_problem )
+						random_permutations();
+					else
+						monte_carlo_sampling();
+
+					model.auxiliary_data->update();
+					current_sat_error = 0.0;
+
+					for( int constraint_id = 0 ; constraint_id < data.number_constraints ; ++constraint_id )
+						current_sat_error += model.constraints[ constraint_id ]->error();
+
+					if( best_sat_error_so_far > current_sat_error )
+					{
+						best_sat_error_so_far = current_sat_error;
+						record_starting_error( best_sat_error_so_far );
+						for( int i = 0 ; i < data.number_variables ; ++i )
+							best_values[ i ] = model.variables[ i ].get_value();
+					}
+				} while( ++loops < samplings && current_sat_error > 0.0 && !interruption_requested() );
+			}
+			else
+				evaluate_samplings_by_batches( samplings, best_values );
+
+			for( int variable_id = 0 ; variable_id < data.number_variables ; ++variable_id )
+				model.variables[ variable_id ].set_value( best_values[ variable_id ] );
+
+			model.auxiliary_data->update();
+		}
+
+		// Draw samplings by batches, and evaluate each batch at once through Constraint::batch_error.
+		// A batch is stored as a structure of arrays in sampling_batch: sampling_batch[ variable_id * number_samples + k ]
+		// is the value of the variable of id variable_id in the k-th sampling. Batches start with one sampling and double
+		// up to 64 samplings, or fewer on large models so that sampling_batch never exceeds 2^16 values. Thus, samplings
+		// still stop soon after finding an assignment satisfying all constraints.
+		// Constraints that do not override optional_batch_error are evaluated by assigning variables sampling after
+		// sampling, until the first sampling with no error. The best sampling is written into best_values.
+		void evaluate_samplings_by_batches( int samplings, std::vector<int>& best_values )
+		{
+			const int max_batch_size = std::max( 1, std::min( 64, ( 1 << 16 ) / std::max( 1, data.number_variables ) ) );
+			int batch_size = 1;
+			double best_sat_error_so_far = std::numeric_limits<double>::max();
+			std::vector<double> sample_errors;
 			int loops = 0;
 
+			bool has_unbatched_constraints = std::any_of( model.constraints.begin(),
+			                                              model.constraints.end(),
+			                                              [&]( const auto& constraint ){ return !constraint->is_optional_batch_error_defined(); } );
+
 			do
 			{
-				if( model.permutation_problem )
-					random_permutations();
-				else
-					monte_carlo_sampling();
+				int number_samples = std::min( { batch_size, max_batch_size, samplings - loops } );
+				batch_size *= 2;
+				sampling_batch.resize( data.number_variables * number_samples );
 
-				model.auxiliary_data->update();
-				current_sat_error = 0.0;
+				for( int k = 0 ; k < number_samples ; ++k )
+				{
+					if( model.permutation_problem )
+						random_permutations();
+					else
+						monte_carlo_sampling();
+
+					for( int variable_id = 0 ; variable_id < data.number_variables ; ++variable_id )
+						sampling_batch[ variable_id * number_samples + k ] = model.variables[ variable_id ]._current_value;
+				}
+				loops += number_samples;
 
+				sample_errors.assign( number_samples, 0.0 );
 				for( int constraint_id = 0 ; constraint_id < data.number_constraints ; ++constraint_id )
-					current_sat_error += model.constraints[ constraint_id ]->error();
+					if( model.constraints[ constraint_id ]->is_optional_batch_error_defined() )
+					{
+						auto errors = model.constraints[ constraint_id ]->batch_error( sampling_batch, number_samples );
+						for( int k = 0 ; k < number_samples ; ++k )
+							sample_errors[ k ] += errors[ k ];
+					}
 
-				if( best_sat_error_so_far > current_sat_error )
+				for( int k = 0 ; k < number_samples ; ++k )
 				{
-					best_sat_error_so_far = current_sat_error;
+					if( has_unbatched_constraints )
+					{
+						for( int variable_id = 0 ; variable_id < data.number_variables ; ++variable_id )
+							model.variables[ variable_id ]._current_value = sampling_batch[ variable_id * number_samples + k ];
+
+						for( int constraint_id = 0 ; constraint_id < data.number_constraints ; ++constraint_id )
+							if( !model.constraints[ constraint_id ]->is_optional_batch_error_defined() )
+								sample_errors[ k ] += model.constraints[ constraint_id ]->error();
+					}
 
-					if( data.best_sat_error > best_sat_error_so_far )
+					if( best_sat_error_so_far > sample_errors[ k ] )
 					{
-#if defined GHOST_TRACE
-						COUT << "Better starting configuration found. Previous error: " << data.best_sat_error << ", now: " << best_sat_error_so_far << "\n";
-#endif
-						data.best_sat_error = best_sat_error_so_far;
+						best_sat_error_so_far = sample_errors[ k ];
+						record_starting_error( best_sat_error_so_far );
+						for( int variable_id = 0 ; variable_id < data.number_variables ; ++variable_id )
+							best_values[ variable_id ] = sampling_batch[ variable_id * number_samples + k ];
 					}
-					for( int i = 0 ; i < data.number_variables ; ++i )
-						best_values[ i ] = model.variables[ i ].get_value();
-				}
-			} while( ++loops < samplings && current_sat_error > 0.0 );
 
-			for( int variable_id = 0 ; variable_id < data.number_variables ; ++variable_id )
-				model.variables[ variable_id ].set_value( best_values[ variable_id ] );
+					if( sample_errors[ k ] == 0.0 )
+						break;
+				}
+			} while( loops < samplings && best_sat_error_so_far > 0.0 && !interruption_requested() );
+		}
 
-			model.auxiliary_data->update();
+		// Lower data.best_sat_error down to the error of a starting sampling, if it is better
+		void record_starting_error( double sat_error )
+		{
+			if( data.best_sat_error > sat_error )
+			{
+#if defined GHOST_TRACE
+				COUT << "Better starting configuration found. Previous error: " << data.best_sat_error << ", now: " << sat_error << "\n";
+#endif
+				data.best_sat_error = sat_error;
+			}
 		}
 
 		// Sample an configuration
@@ -256,8 +426,13 @@ namespace ghost
 
 		void initialize_data_structures()
 		{
+			// Variable values may all have changed
+			restart_journal();
+
 			must_compute_variable_candidates = true;
 			std::fill( data.tabu_list.begin(), data.tabu_list.end(), 0 );
+			if( configuration_checking )
+				std::fill( data.configuration_changed.begin(), data.configuration_changed.end(), true );
 
 			// Reset constraints costs
 			for( int constraint_id = 0; constraint_id < data.number_constraints; ++constraint_id )
@@ -268,25 +443,25 @@ namespace ghost
 			if( data.best_sat_error > data.current_sat_error )
 			{
 				data.best_sat_error = data.current_sat_error;
-				std::transform( model.variables.begin(),
-				                model.variables.end(),
-				                final_solution.begin(),
-				                [&](auto& var){ return var.get_value(); } );
+				record_improvement();
+				GHOST_PROBE3( new_best, data.search_iterations, GHOST_PROBE_ERROR( data.best_sat_error ), GHOST_PROBE_ERROR( data.best_opt_cost ) );
+				record_best_solution();
 			}
 
-			// (Re)compute the current optimization cost
+			// (Re)compute the current optimization cost.
+			// The cost is computed in any case, to rebuild inner data structures of the objective function.
 			if( data.is_optimization )
 			{
+				double current_opt_cost = model.objective->cost();
 				if( data.current_sat_error == 0 ) [[unlikely]]
 				{
-					data.current_opt_cost = model.objective->cost();
+					data.current_opt_cost = current_opt_cost;
 					if( data.best_opt_cost > data.current_opt_cost )
 					{
 						data.best_opt_cost = data.current_opt_cost;
-						std::transform( model.variables.begin(),
-						                model.variables.end(),
-						                final_solution.begin(),
-						                [&](auto& var){ return var.get_value(); } );
+						record_improvement();
+						GHOST_PROBE3( new_best, data.search_iterations, GHOST_PROBE_ERROR( data.best_sat_error ), GHOST_PROBE_ERROR( data.best_opt_cost ) );
+						record_best_solution();
 					}
 				}
 				else
@@ -306,12 +481,72 @@ namespace ghost
 			for( int constraint_id = 0; constraint_id < data.number_constraints; ++constraint_id )
 				try
 				{
-					model.constraints[ constraint_id ]->optional_delta_error( model.constraints[ constraint_id ]->_variables, std::vector<int>{0}, std::vector<int>{model.variables[0].get_value()} );
+					// Compute the error first, so that inner data structures of the constraint are built
+					// before probing optional_delta_error with the current value of its first variable.
+					model.constraints[ constraint_id ]->_current_error = model.constraints[ constraint_id ]->error();
+					model.constraints[ constraint_id ]->optional_delta_error( model.constraints[ constraint_id ]->_variables,
+					                                                          std::vector<int>{0},
+					                                                          std::vector<int>{model.constraints[ constraint_id ]->_variables[0]->get_value()} );
 				}
 				catch( const std::exception& e )
 				{
 					std::cerr << "No optional_delta_error method defined for constraint num. " << constraint_id << "\n";
 				}
+
+			// Same for optional_delta_error_on_domain, without warnings since it is really optional
+			for( int constraint_id = 0; constraint_id < data.number_constraints; ++constraint_id )
+				try
+				{
+					model.constraints[ constraint_id ]->optional_delta_error_on_domain( model.constraints[ constraint_id ]->_variables,
+					                                                                    0,
+					                                                                    std::vector<int>{model.constraints[ constraint_id ]->_variables[0]->get_value()} );
+				}
+				catch( const std::exception& e )
+				{ }
+
+			// Same for optional_plausible_values
+			for( int constraint_id = 0; constraint_id < data.number_constraints; ++constraint_id )
+				try
+				{
+					model.constraints[ constraint_id ]->optional_plausible_values( model.constraints[ constraint_id ]->_variables,
+					                                                               0,
+					                                                               std::vector<int>{model.constraints[ constraint_id ]->_variables[0]->get_value()} );
+				}
+				catch( const std::exception& e )
+				{ }
+
+			// Same for optional_batch_error, probed on a batch made of the current assignment only
+			for( int constraint_id = 0; constraint_id < data.number_constraints; ++constraint_id )
+				try
+				{
+					std::vector<int> values( model.constraints[ constraint_id ]->_variables.size() );
+					std::transform( model.constraints[ constraint_id ]->_variables.begin(),
+					                model.constraints[ constraint_id ]->_variables.end(),
+					                values.begin(),
+					                [&]( auto& var ){ return var->get_value(); } );
+
+					model.constraints[ constraint_id ]->optional_batch_error( model.constraints[ constraint_id ]->_variables, values, 1 );
+				}
+				catch( const std::exception& e )
+				{ }
+
+			// Swaps within the scope of permutation-invariant constraints are skipped in permutation problems
+			for( int constraint_id = 0; constraint_id < data.number_constraints; ++constraint_id )
+				model.constraints[ constraint_id ]->_is_permutation_invariant = model.permutation_problem
+					&& model.constraints[ constraint_id ]->optional_is_permutation_invariant( model.constraints[ constraint_id ]->_variables );
+
+			// Same for optional_delta_cost of the objective function, computing its cost first
+			// for the same reason as above
+			if( data.is_optimization )
+				try
+				{
+					model.objective->cost();
+					model.objective->optional_delta_cost( model.objective->_variables,
+					                                      std::vector<int>{0},
+					                                      std::vector<int>{model.objective->_variables[0]->get_value()} );
+				}
+				catch( const std::exception& e )
+				{ }
 		}
 
 		void reset()
@@ -322,6 +557,7 @@ namespace ghost
 			if( options.restart_threshold > 0 && ( data.resets % options.restart_threshold == 0 ) )
 			{
 				++data.restarts;
+				GHOST_PROBE1( restart, data.restarts );
 
 				// Start from a given starting configuration, or a random one.
 				initialize_variable_values();
@@ -334,6 +570,7 @@ namespace ghost
 			}
 			else // real reset
 			{
+				GHOST_PROBE1( reset, data.resets );
 				if( model.permutation_problem )
 					random_permutations( options.number_variables_to_reset );
 				else
@@ -397,6 +634,10 @@ namespace ghost
 				for( const int constraint_id : data.matrix_var_ctr.at( variable_to_change ) )
 				{
 					constraint_checked[ constraint_id ] = true;
+					// Swapped values stay in the scope of the constraint: nothing to update
+					if( model.constraints[ constraint_id ]->_is_permutation_invariant && model.constraints[ constraint_id ]->has_variable( new_value ) )
+						continue;
+
 					auto delta = delta_errors.at( new_value )[ delta_index++ ];
 					model.constraints[ constraint_id ]->_current_error += delta;
 
@@ -435,9 +676,38 @@ namespace ghost
 			}
 		}
 
+		// Difference of the objective function cost if the move (variable_to_change, new_value) is done,
+		// new_value being the variable to swap values with for permutation problems.
+		double compute_objective_delta_cost( int variable_to_change, int new_value ) const
+		{
+			if( model.permutation_problem )
+				return model.objective->delta_cost( std::vector<int>{ variable_to_change, new_value },
+				                                    std::vector<int>{ model.variables[ new_value ].get_value(), model.variables[ variable_to_change ].get_value() } );
+			else
+				return model.objective->delta_cost( std::vector<int>{ variable_to_change }, std::vector<int>{ new_value } );
+		}
+
+		// Configuration checking: variables sharing a constraint with a moved variable become eligible again,
+		// while moved variables stay ineligible until one of their neighbors changes.
+		// Nothing to do if the variable candidates heuristic does not rely on configuration checking.
+		void update_configurations( const std::vector<int>& moved_variables )
+		{
+			if( !configuration_checking )
+				return;
+
+			for( int variable_id : moved_variables )
+				for( int constraint_id : data.matrix_var_ctr[ variable_id ] )
+					for( int neighbor_id : model.constraints[ constraint_id ]->_variables_index )
+						data.configuration_changed[ neighbor_id ] = true;
+
+			for( int variable_id : moved_variables )
+				data.configuration_changed[ variable_id ] = false;
+		}
+
 		// A. Local move (perform local move and update variables/constraints/objective function)
 		void local_move( int variable_to_change, int new_value, double min_conflict, const std::map< int, std::vector<double>>& delta_errors )
 		{
+			GHOST_PROBE3( move, variable_to_change, new_value, GHOST_PROBE_ERROR( min_conflict ) );
 			++data.local_moves;
 			data.current_sat_error += min_conflict;
 			data.tabu_list[ variable_to_change ] = options.tabu_time_selected + data.local_moves;
@@ -452,22 +722,32 @@ namespace ghost
 
 				model.variables[ variable_to_change ].set_value( next_value );
 				model.variables[ new_value ].set_value( current_value );
+				journal_value( variable_to_change, next_value );
+				journal_value( new_value, current_value );
 
 				model.auxiliary_data->update( variable_to_change, next_value );
 				model.auxiliary_data->update( new_value, current_value );
+
+				update_configurations( std::vector<int>{ variable_to_change, new_value } );
 			}
 			else
 			{
 				model.variables[ variable_to_change ].set_value( new_value );
+				journal_value( variable_to_change, new_value );
 
 				model.auxiliary_data->update( variable_to_change, new_value );
+
+				update_configurations( std::vector<int>{ variable_to_change } );
 			}
+
+			limit_journal();
 		}
 
 		// B. Plateau management (local move on the plateau, but options.percent_chance_escape_plateau
 		//                        of chance to escape it and mark the variable as tabu.)
 		void plateau_management( int variable_to_change, int new_value, const std::map< int, std::vector<double>>& delta_errors )
 		{
+			GHOST_PROBE1( plateau, variable_to_change );
 			if( rng.uniform(0, 100) <= options.percent_chance_escape_plateau )
 			{
 				data.tabu_list[ variable_to_change ] = options.tabu_time_local_min + data.local_moves;
@@ -493,6 +773,7 @@ namespace ghost
 				data.tabu_list[ variable_to_change ] = options.tabu_time_local_min + data.local_moves;
 				must_compute_variable_candidates = true;
 				++data.local_minimum;
+				GHOST_PROBE1( local_minimum, variable_to_change );
 			}
 			else
 			{
@@ -503,512 +784,938 @@ namespace ghost
 			}
 		}
 
-	public:
-		Model model;
+		// One iteration of the search loop: choose a variable, a new value, then make or reject the move
+		// Simulate the delta errors of assigning each given value to the variable, constraint by constraint,
+		// so that each of them can compute deltas of all values at once. Return false if the search must be interrupted.
+		bool simulate_delta_errors_on_domain( int variable_to_change, const std::vector<int>& values, std::map<int, std::vector<double>>& delta_errors )
+		{
+			for( const int constraint_id : data.matrix_var_ctr.at( variable_to_change ) )
+			{
+				if( must_interrupt() )
+					return false;
 
-		std::vector<Variable> variables_at_start;
-		randutils::mt19937_rng rng;
+				auto deltas = model.constraints[ constraint_id ]->simulate_delta_on_domain( variable_to_change, values );
+				for( int value_index = 0 ; value_index < static_cast<int>( values.size() ) ; ++value_index )
+					delta_errors[ values[ value_index ] ].push_back( deltas[ value_index ] );
+			}
 
-		SearchUnitData data;
-		std::unique_ptr<algorithms::VariableHeuristic> variable_heuristic;
-		std::unique_ptr<algorithms::VariableCandidatesHeuristic> variable_candidates_heuristic;
-		std::unique_ptr<algorithms::ValueHeuristic> value_heuristic;
-		std::unique_ptr<algorithms::ErrorProjection> error_projection_heuristic;
-				
-		std::vector<int> final_solution;
+			return true;
+		}
 
-		std::vector<double> variable_candidates;
-		bool must_compute_variable_candidates;
+		// Move from domain_to_explore to other_values all values that none of the constraints of the variable
+		// considers plausible. Leave domain_to_explore untouched if a constraint does not define plausible values.
+		void filter_plausible_values( int variable_to_change, std::vector<int>& domain_to_explore, std::vector<int>& other_values )
+		{
+			for( const int constraint_id : data.matrix_var_ctr.at( variable_to_change ) )
+				if( !model.constraints[ constraint_id ]->is_optional_plausible_values_defined() )
+					return;
 
-		std::promise<bool> solution_found;
+			std::vector<bool> is_plausible( domain_to_explore.size(), false );
+			for( const int constraint_id : data.matrix_var_ctr.at( variable_to_change ) )
+			{
+				// Values returned by a constraint are in the same order as domain_to_explore
+				auto plausible_values = model.constraints[ constraint_id ]->plausible_values( variable_to_change, domain_to_explore );
+				int value_index = 0;
+				for( const int value : plausible_values )
+				{
+					while( value_index < static_cast<int>( domain_to_explore.size() ) && domain_to_explore[ value_index ] != value )
+						++value_index;
+					if( value_index == static_cast<int>( domain_to_explore.size() ) )
+						break;
+					is_plausible[ value_index++ ] = true;
+				}
+			}
 
-		Options options;
+			int kept = 0;
+			for( int value_index = 0 ; value_index < static_cast<int>( domain_to_explore.size() ) ; ++value_index )
+				if( is_plausible[ value_index ] )
+					domain_to_explore[ kept++ ] = domain_to_explore[ value_index ];
+				else
+					other_values.push_back( domain_to_explore[ value_index ] );
 
-		SearchUnit( Model&& moved_model,
-		            const Options& options,
-		            std::unique_ptr<algorithms::VariableHeuristic> variable_heuristic,
-		            std::unique_ptr<algorithms::VariableCandidatesHeuristic> variable_candidates_heuristic,
-		            std::unique_ptr<algorithms::ValueHeuristic> value_heuristic,
-		            std::unique_ptr<algorithms::ErrorProjection> error_projection_heuristic )
-			: _stop_search_check( _stop_search_signal.get_future() ),
-			  model( std::move( moved_model ) ),
-			  data( model ),
-			  variable_heuristic( std::move( variable_heuristic ) ),
-			  variable_candidates_heuristic( std::move( variable_candidates_heuristic ) ),
-			  value_heuristic( std::move( value_heuristic ) ),
-			  error_projection_heuristic( std::move( error_projection_heuristic ) ),
-			  final_solution( std::vector<int>( data.number_variables, 0 ) ),
-			  variable_candidates(), 
-			  must_compute_variable_candidates ( true ),
-			  options ( options )
+			domain_to_explore.resize( kept );
+		}
+
+		// Simulate the delta error of each constraint affected by the move. Return the sum of these deltas.
+		double evaluate_move( const algorithms::Move& move, std::vector<int>& move_constraints, std::vector<double>& move_deltas )
 		{
-			std::transform( model.variables.begin(),
-			                model.variables.end(),
-			                std::back_inserter( variables_at_start ),
-			                [&]( auto& v){ return v; } );
+			move_constraints.clear();
+			move_deltas.clear();
+
+			for( const int variable_id : move.variables )
+				move_constraints.insert( move_constraints.end(), data.matrix_var_ctr.at( variable_id ).begin(), data.matrix_var_ctr.at( variable_id ).end() );
+			std::sort( move_constraints.begin(), move_constraints.end() );
+			move_constraints.erase( std::unique( move_constraints.begin(), move_constraints.end() ), move_constraints.end() );
+
+			double sat_delta = 0.0;
+			std::vector<int> variables_in_scope;
+			std::vector<int> values_in_scope;
+			for( const int constraint_id : move_constraints )
+			{
+				variables_in_scope.clear();
+				values_in_scope.clear();
+				for( int i = 0 ; i < static_cast<int>( move.variables.size() ) ; ++i )
+					if( model.constraints[ constraint_id ]->has_variable( move.variables[ i ] ) )
+					{
+						variables_in_scope.push_back( move.variables[ i ] );
+						values_in_scope.push_back( move.values[ i ] );
+					}
 
-			initialize_data_structures( model );
-			data.initialize_matrix( model );
+				move_deltas.push_back( model.constraints[ constraint_id ]->simulate_delta( variables_in_scope, values_in_scope ) );
+				sat_delta += move_deltas.back();
+			}
 
-			this->error_projection_heuristic->set_number_variables( data.number_variables );
-			this->error_projection_heuristic->set_number_constraints( data.number_constraints );
-			this->error_projection_heuristic->initialize_data_structures();
+			return sat_delta;
+		}
 
-#if defined GHOST_TRACE
-			COUT << "Creating a Solver object\n\n"
-			     << "Variables:\n";
+		// Difference of the objective function cost if the move is made.
+		double compute_objective_delta_cost( const algorithms::Move& move )
+		{
+			if( model.objective->_is_optional_delta_cost_defined )
+				return model.objective->delta_cost( move.variables, move.values );
 
-			for( const auto& variable : model.variables )
-				COUT << variable << "\n";
+			if( data.current_opt_cost == std::numeric_limits<double>::max() )
+				data.current_opt_cost = model.objective->cost();
 
-			COUT << "\nConstraints:\n";
-			for( auto constraint : model.constraints )
-				COUT << *constraint << "\n";
+			std::vector<int> backup_values( move.variables.size() );
+			for( int i = 0 ; i < static_cast<int>( move.variables.size() ) ; ++i )
+			{
+				backup_values[ i ] = model.variables[ move.variables[ i ] ].get_value();
+				model.variables[ move.variables[ i ] ].set_value( move.values[ i ] );
+				model.auxiliary_data->update( move.variables[ i ], move.values[ i ] );
+			}
 
-			COUT << "\nObjective function:\n"
-			     << *(model.objective) << "\n";
-#endif
-		}
+			double candidate_opt_cost = model.objective->cost();
 
-		SearchUnit( Model&& moved_model, const Options& options )
-			: SearchUnit( std::move( moved_model ),
-			              options,
-			              std::make_unique<algorithms::AdaptiveSearchVariableHeuristic>(),
-			              std::make_unique<algorithms::AdaptiveSearchVariableCandidatesHeuristic>(),
-			              std::make_unique<algorithms::AdaptiveSearchValueHeuristic>(),
-			              std::make_unique<algorithms::AdaptiveSearchErrorProjection>() )
-		{ }
+			for( int i = static_cast<int>( move.variables.size() ) - 1 ; i >= 0 ; --i )
+			{
+				model.variables[ move.variables[ i ] ].set_value( backup_values[ i ] );
+				model.auxiliary_data->update( move.variables[ i ], backup_values[ i ] );
+			}
 
-		
-		// Check if the thread must stop search
-		bool stop_search_requested()
-		{
-			if( _stop_search_check.wait_for( std::chrono::microseconds( 0 ) ) == std::future_status::ready )
-				return true;
-			else
-				return false;
+			return candidate_opt_cost - data.current_opt_cost;
 		}
 
-		void get_thread_id( std::thread::id id )
+		// Make a move from a neighborhood, with the deltas of its affected constraints given by evaluate_move.
+		void compound_move( int variable_to_change, const algorithms::Move& move, const std::vector<int>& move_constraints, const std::vector<double>& move_deltas, double sat_delta )
 		{
-			_thread_id = id;
-#if defined GHOST_TRACE_PARALLEL
-			_log_filename << "test_run_parallel_" << _thread_id << ".txt";
-			_log_trace.open( _log_filename.str() );
-#endif
+			GHOST_PROBE3( compound_move, variable_to_change, static_cast<int>( move.variables.size() ), GHOST_PROBE_ERROR( sat_delta ) );
+			++data.local_moves;
+			++data.compound_moves;
+			data.current_sat_error += sat_delta;
+			data.tabu_list[ variable_to_change ] = options.tabu_time_selected + data.local_moves;
+			must_compute_variable_candidates = true;
 
-#if defined GHOST_TRACE
-			COUT << "Creating a search unit for thread number " << _thread_id << "\n";
-#endif
-		}
+			bool incremental_cost = data.is_optimization && model.objective->_is_optional_delta_cost_defined && data.current_opt_cost != std::numeric_limits<double>::max();
+			if( incremental_cost )
+				data.current_opt_cost += model.objective->delta_cost( move.variables, move.values );
 
-		// Request the thread to stop searching
-		inline void stop_search()	{	_stop_search_signal.set_value(); }
-		inline Model&& transfer_model() { return std::move( model ); }
+			// Constraints and the objective function are updated while all variables still have their former values
+			for( int index = 0 ; index < static_cast<int>( move_constraints.size() ) ; ++index )
+			{
+				auto& constraint = model.constraints[ move_constraints[ index ] ];
+				constraint->_current_error += move_deltas[ index ];
+
+				error_projection_heuristic->update_variable_errors( data.error_variables,
+				                                                    model.variables,
+				                                                    data.matrix_var_ctr,
+				                                                    constraint,
+				                                                    move_deltas[ index ] );
+
+				for( int i = 0 ; i < static_cast<int>( move.variables.size() ) ; ++i )
+					if( constraint->has_variable( move.variables[ i ] ) )
+						constraint->update( move.variables[ i ], move.values[ i ] );
+			}
 
-		// Method doing the search; called by Solver::solve (eventually in several threads).
-		// Return true iff a solution has been found
-		void search( double timeout )
-		{
-			// TODO: Antidote search
-			// TODO: Neighborhood
+			if( data.is_optimization )
+				for( int i = 0 ; i < static_cast<int>( move.variables.size() ) ; ++i )
+					model.objective->update( move.variables[ i ], move.values[ i ] );
 
-			// 1. Choice of worst variable(s) to change
-			// 2. Choice of their new value
-			// 3. Error improved => make local move
-			// 4. Same error
-			// 4.a. Optimization cost improved => make local move
-			// 4.b. Same optimization cost => plateau
-			// 4.c. Worst optimization cost => local minimum
-			// 4.d. Not an optimization problem => plateau
-			// 5. Worst error => local minimum
+			for( int i = 0 ; i < static_cast<int>( move.variables.size() ) ; ++i )
+			{
+				model.variables[ move.variables[ i ] ].set_value( move.values[ i ] );
+				journal_value( move.variables[ i ], move.values[ i ] );
+				model.auxiliary_data->update( move.variables[ i ], move.values[ i ] );
+			}
+			limit_journal();
 
-			// A. Local move (perform local move and update variables/constraints/objective function)
-			// B. Plateau management (local move on the plateau, but x% of chance to escape it, mark the variable as tabu.)
-			// C. local minimum management (if there are no other worst variables to try, mark the variable as tabu.
-			//                              Otherwise try them first, but with x% of chance, the solver fianlly marks the variable as tabu.)
+			update_configurations( move.variables );
 
-			std::chrono::duration<double,std::micro> elapsed_time( 0 );
-			std::chrono::time_point<std::chrono::steady_clock> start( std::chrono::steady_clock::now() );
+			if( data.is_optimization && !incremental_cost )
+				data.current_opt_cost = model.objective->cost();
+		}
 
-			data.best_sat_error = std::numeric_limits<double>::max();
-			data.best_opt_cost = std::numeric_limits<double>::max();
+		// Explore neighborhoods from options.neighborhoods in order, and make the best move of the first neighborhood
+		// decreasing the error, or keeping it and decreasing the objective function cost.
+		// Return false if no such move has been found, or if the search must be interrupted.
+		bool explore_neighborhoods( int variable_to_change )
+		{
+			std::vector<int> move_constraints;
+			std::vector<double> move_deltas;
 
-			initialize_variable_values();
-			initialize_data_structures();
+			for( const auto& neighborhood : options.neighborhoods )
+			{
+				auto moves = neighborhood->get_moves( variable_to_change, data, model, rng );
+
+				double min_conflict = std::numeric_limits<double>::max();
+				std::vector<int> best_moves;
+				for( int move_index = 0 ; move_index < static_cast<int>( moves.size() ) ; ++move_index )
+				{
+					if( must_interrupt() )
+						return false;
+
+					double sat_delta = evaluate_move( moves[ move_index ], move_constraints, move_deltas );
+					if( min_conflict > sat_delta )
+					{
+						best_moves.clear();
+						best_moves.push_back( move_index );
+						min_conflict = sat_delta;
+					}
+					else
+						if( min_conflict == sat_delta )
+							best_moves.push_back( move_index );
+				}
+
+				if( best_moves.empty() || min_conflict > 0.0 )
+					continue;
+
+				int best_move = rng.pick( best_moves );
+
+				// Among moves keeping the error, look for the one decreasing the most the objective function cost
+				if( min_conflict == 0.0 )
+				{
+					if( !data.is_optimization )
+						continue;
+
+					double min_cost_delta = 0.0;
+					best_move = -1;
+					for( const int move_index : best_moves )
+					{
+						double cost_delta = compute_objective_delta_cost( moves[ move_index ] );
+						if( min_cost_delta > cost_delta )
+						{
+							min_cost_delta = cost_delta;
+							best_move = move_index;
+						}
+					}
+
+					if( best_move == -1 )
+						continue;
+				}
 
+				evaluate_move( moves[ best_move ], move_constraints, move_deltas );
+				compound_move( variable_to_change, moves[ best_move ], move_constraints, move_deltas, min_conflict );
+				return true;
+			}
+
+			return false;
+		}
+
+		// The best assignment is only written into final_solution when needed: values assigned by local
+		// and compound moves are journaled from journal_base, the assignment when the journal started, and
+		// recording a new best assignment only saves the length of the journal.
+		inline void record_best_solution() { best_journal_length = static_cast<int>( journal.size() ); }
+
+		inline void journal_value( int variable_id, int value ) { journal.emplace_back( variable_id, value ); }
+
+		// Write the best assignment into final_solution if it has been recorded since the journal started.
+		void materialize_best_solution()
+		{
+			if( best_journal_length < 0 )
+				return;
+
+			std::copy( journal_base.begin(), journal_base.end(), final_solution.begin() );
+			for( int index = 0 ; index < best_journal_length ; ++index )
+				final_solution[ journal[ index ].first ] = journal[ index ].second;
+			best_journal_length = -1;
+		}
+
+		// Start a new journal from the current assignment.
+		void restart_journal()
+		{
+			materialize_best_solution();
 			std::transform( model.variables.begin(),
 			                model.variables.end(),
-			                final_solution.begin(),
+			                journal_base.begin(),
 			                [&](auto& var){ return var.get_value(); } );
+			journal.clear();
+		}
 
-			elapsed_time = std::chrono::steady_clock::now() - start;
-			using namespace std::chrono_literals;
-
-			int variable_to_change;
+		// Restart the journal once it is longer than the number of variables, so that replaying it
+		// costs no more than copying the assignment, and the memory it takes stays bounded.
+		inline void limit_journal()
+		{
+			if( static_cast<int>( journal.size() ) > data.number_variables )
+				restart_journal();
+		}
 
-			// While timeout is not reached, and the solver didn't satisfied all constraints
-			// OR
-			// it is working on an optimization problem,
-			// continue the search.
-			while( !stop_search_requested()
-			       &&  elapsed_time.count() < timeout
-			       && ( data.best_sat_error > 0.0 || ( data.best_sat_error == 0.0 && data.is_optimization ) ) )
+		// Save the current assignment if it is the best one found so far.
+		void update_best_solution()
+		{
+			if( data.best_sat_error > data.current_sat_error )
 			{
-				++data.search_iterations;
+#if defined GHOST_TRACE
+				COUT << "Best satisfaction error so far (in an optimization problem). Before: " << data.best_sat_error << ", now: " << data.current_sat_error << "\n";
+#endif
+				data.best_sat_error = data.current_sat_error;
+				record_improvement();
+				GHOST_PROBE3( new_best, data.search_iterations, GHOST_PROBE_ERROR( data.best_sat_error ), GHOST_PROBE_ERROR( data.best_opt_cost ) );
+				record_best_solution();
+			}
+			else
+				if( data.is_optimization && data.current_sat_error == 0.0 && data.best_opt_cost > data.current_opt_cost )
+				{
+#if defined GHOST_TRACE
+					COUT << "Best objective function value so far. Before: " << data.best_opt_cost << ", now: " << data.current_opt_cost << "\n";
+#endif
+					data.best_opt_cost = data.current_opt_cost;
+					record_improvement();
+					GHOST_PROBE3( new_best, data.search_iterations, GHOST_PROBE_ERROR( data.best_sat_error ), GHOST_PROBE_ERROR( data.best_opt_cost ) );
+					record_best_solution();
+				}
+		}
 
-				/********************************************
-				 * 1. Choice of worst variable(s) to change *
-				 ********************************************/
+		void search_iteration()
+		{
+			++data.search_iterations;
+			GHOST_PROBE1( iteration_start, data.search_iterations );
+
+			/********************************************
+			 * 1. Choice of worst variable(s) to change *
+			 ********************************************/
 #if defined GHOST_TRACE
-				for( int i = 0 ; i < data.number_variables; ++i )
-					COUT << "Projected error of var[" << i << "]: " << data.error_variables[i] << "\n";
+			for( int i = 0 ; i < data.number_variables; ++i )
+				COUT << "Projected error of var[" << i << "]: " << data.error_variables[i] << "\n";
 #endif
 
-				
-				// Estimate which variables need to be changed
-				if( must_compute_variable_candidates )
-					variable_candidates = variable_candidates_heuristic->compute_variable_candidates( data );
+			
+			// Estimate which variables need to be changed
+			if( must_compute_variable_candidates )
+				variable_candidates_heuristic->compute_variable_candidates( data, variable_candidates );
 
 #if defined GHOST_TRACE
-				if( std::count_if( data.tabu_list.begin(),
-				                   data.tabu_list.end(),
-				                   [&](int end_tabu){ return end_tabu > data.local_moves; } ) >= options.reset_threshold )
-					COUT << "Number of variables marked as tabu above the threshold " << data.local_moves << "\n";
-				if( variable_candidates.empty() )
-					COUT << "Vector of variable candidates empty\n";
+			if( std::count_if( data.tabu_list.begin(),
+			                   data.tabu_list.end(),
+			                   [&](int end_tabu){ return end_tabu > data.local_moves; } ) >= options.reset_threshold )
+				COUT << "Number of variables marked as tabu above the threshold " << data.local_moves << "\n";
+			if( variable_candidates.empty() )
+				COUT << "Vector of variable candidates empty\n";
 #endif
-				
-				if( std::count_if( data.tabu_list.begin(),
-				                   data.tabu_list.end(),
-				                   [&](int end_tabu){ return end_tabu > data.local_moves; } ) >= options.reset_threshold
-				    || variable_candidates.empty() )
+			
+			if( std::count_if( data.tabu_list.begin(),
+			                   data.tabu_list.end(),
+			                   [&](int end_tabu){ return end_tabu > data.local_moves; } ) >= options.reset_threshold
+			    || variable_candidates.empty() )
+			{
+				// Do not start a reset or a restart if the search must be interrupted
+				if( must_interrupt() )
 				{
+					++data.interrupted_iterations;
+					return;
+				}
+
 #if defined GHOST_TRACE
-					COUT << "No variables left to be changed: reset.\n";
+				COUT << "No variables left to be changed: reset.\n";
 #endif
-					reset();
-					continue;
-				}
+				reset();
+				return;
+			}
 
 #if defined GHOST_TRACE
-				COUT << "\n(Meaningful with Adaptive Search Variable Candidates Heuristic only) Variable candidates: v[" << static_cast<int>( variable_candidates[0] ) << "]=" << model.variables[ static_cast<int>( variable_candidates[0] ) ].get_value();
-				for( int i = 1 ; i < static_cast<int>( variable_candidates.size() ) ; ++i )
-					COUT << ", v[" << static_cast<int>( variable_candidates[i] ) << "]=" << model.variables[ static_cast<int>( variable_candidates[i] ) ].get_value();
-				COUT << "\n";
+			COUT << "\nVariable candidates: v[" << variable_candidates[0] << "]=" << model.variables[ variable_candidates[0] ].get_value();
+			for( int i = 1 ; i < variable_candidates.size() ; ++i )
+				COUT << ", v[" << variable_candidates[i] << "]=" << model.variables[ variable_candidates[i] ].get_value();
+			COUT << "\n";
 
-				auto distrib = std::discrete_distribution<int>( data.error_variables.begin(), data.error_variables.end() );
-				std::vector<int> vec( data.number_variables, 0 );
-				for( int n = 0 ; n < 10000 ; ++n )
-					++vec[ rng.variate<int, std::discrete_distribution>( distrib ) ];
-				std::vector<std::pair<int,int>> vec_pair( data.number_variables );
-				for( int n = 0 ; n < data.number_variables ; ++n )
-					vec_pair[n] = std::make_pair( n, vec[n] );
-				std::sort( vec_pair.begin(), vec_pair.end(), [&](std::pair<int, int> &a, std::pair<int, int> &b){ return a.second > b.second; } );
-				COUT << "\n(Meaningful with Antidote Search Variable Candidates Heuristic only) Variable errors (normalized):\n";
-				for( auto &v : vec_pair )
-					COUT << "v[" << v.first << "]: " << std::fixed << std::setprecision(3) << static_cast<double>( v.second ) / 10000 << "\n";
+			auto distrib = std::discrete_distribution<int>( data.error_variables.begin(), data.error_variables.end() );
+			std::vector<int> vec( data.number_variables, 0 );
+			for( int n = 0 ; n < 10000 ; ++n )
+				++vec[ rng.variate<int, std::discrete_distribution>( distrib ) ];
+			std::vector<std::pair<int,int>> vec_pair( data.number_variables );
+			for( int n = 0 ; n < data.number_variables ; ++n )
+				vec_pair[n] = std::make_pair( n, vec[n] );
+			std::sort( vec_pair.begin(), vec_pair.end(), [&](std::pair<int, int> &a, std::pair<int, int> &b){ return a.second > b.second; } );
+			COUT << "\n(Meaningful with Antidote Search Variable Candidates Heuristic only) Variable errors (normalized):\n";
+			for( auto &v : vec_pair )
+				COUT << "v[" << v.first << "]: " << std::fixed << std::setprecision(3) << static_cast<double>( v.second ) / 10000 << "\n";
 #endif
 
-				variable_to_change = variable_heuristic->select_variable_candidate( variable_candidates, data, rng );
+			int variable_to_change = variable_heuristic->select_variable_candidate( variable_candidates, data, rng );
 
 #if defined GHOST_TRACE
-				COUT << options.print->print_candidate( model.variables ).str();
-				COUT << "\n\nNumber of loop iteration: " << data.search_iterations << "\n";
-				COUT << "Number of local moves performed: " << data.local_moves << "\n";
-				COUT << "Tabu list:";
-				for( int i = 0 ; i < data.number_variables ; ++i )
-					if( data.tabu_list[i] > data.local_moves )
-						COUT << " v[" << i << "]:" << data.tabu_list[i];
-				COUT << "\nPicked worst variable: v[" << variable_to_change << "]=" << model.variables[ variable_to_change ].get_value() << "\n\n";
+			COUT << options.print->print_candidate( model.variables ).str();
+			COUT << "\n\nNumber of loop iteration: " << data.search_iterations << "\n";
+			COUT << "Number of local moves performed: " << data.local_moves << "\n";
+			COUT << "Tabu list:";
+			for( int i = 0 ; i < data.number_variables ; ++i )
+				if( data.tabu_list[i] > data.local_moves )
+					COUT << " v[" << i << "]:" << data.tabu_list[i];
+			COUT << "\nPicked worst variable: v[" << variable_to_change << "]=" << model.variables[ variable_to_change ].get_value() << "\n\n";
 #endif // end GHOST_TRACE
 
-				/********************************
-				 * 2. Choice of their new value *
-				 ********************************/
-				// Can we erase an element by "mistake" if we use the Antidote's variable heuristic? Is it a big deal?
-				auto ref = std::find( variable_candidates.begin(), variable_candidates.end(), static_cast<double>( variable_to_change ) );
-				if( ref != variable_candidates.end() )
-					variable_candidates.erase( ref );
-				
-				// So far, we consider full domains only.
-				auto domain_to_explore = model.variables[ variable_to_change ].get_full_domain();
-				// Remove the current value
-				domain_to_explore.erase( std::find( domain_to_explore.begin(), domain_to_explore.end(), model.variables[ variable_to_change ].get_value() ) );
-				std::map<int, std::vector<double>> delta_errors;
+			/********************************
+			 * 2. Choice of their new value *
+			 ********************************/
+			// So far, we consider full domains only.
+			auto domain_to_explore = model.variables[ variable_to_change ].get_full_domain();
+			// Remove the current value
+			domain_to_explore.erase( std::find( domain_to_explore.begin(), domain_to_explore.end(), model.variables[ variable_to_change ].get_value() ) );
+			std::map<int, std::vector<double>> delta_errors;
 
-				if( !model.permutation_problem )
+			if( !model.permutation_problem )
+			{
+				// Simulate delta errors (or errors is not Constraint::optional_delta_error method is defined) for each neighbor.
+				if( !data.matrix_var_ctr.at( variable_to_change ).empty() ) [[likely]]
 				{
-					// Simulate delta errors (or errors is not Constraint::optional_delta_error method is defined) for each neighbor
-					for( const auto candidate_value : domain_to_explore )
+					// While some constraints are violated, first simulate values that may decrease the error of some constraint.
+					// Other values cannot decrease the global error, and are only needed if no plausible values decrease it either.
+					std::vector<int> other_values;
+					if( data.current_sat_error > 0.0 )
+						filter_plausible_values( variable_to_change, domain_to_explore, other_values );
+
+					// Abandon a partially evaluated neighborhood: no moves are made on incomplete deltas
+					if( !simulate_delta_errors_on_domain( variable_to_change, domain_to_explore, delta_errors ) )
 					{
-						if( !data.matrix_var_ctr.at( variable_to_change ).empty() ) [[likely]]
-							for( const int constraint_id : data.matrix_var_ctr.at( variable_to_change ) )
-								delta_errors[ candidate_value ].push_back( model.constraints[ constraint_id ]->simulate_delta( std::vector<int>{variable_to_change}, std::vector<int>{candidate_value} ) );
-						else
-							delta_errors[ candidate_value ].push_back( 0.0 );
+						++data.interrupted_iterations;
+						return;
+					}
+
+					if( !other_values.empty() )
+					{
+						if( std::any_of( delta_errors.begin(),
+						                 delta_errors.end(),
+						                 []( const auto& deltas ){ return std::accumulate( deltas.second.begin(), deltas.second.end(), 0.0 ) < 0.0; } ) )
+							data.filtered_values += static_cast<int>( other_values.size() );
+						else if( !simulate_delta_errors_on_domain( variable_to_change, other_values, delta_errors ) )
+						{
+							++data.interrupted_iterations;
+							return;
+						}
 					}
 				}
 				else
-				{
-					for( int variable_id = 0 ; variable_id < data.number_variables; ++variable_id )
-						// look at other variables than the selected one, with other values but contained into the selected variable's domain
-						if( variable_id != variable_to_change
-						    && model.variables[ variable_id ].get_value() != model.variables[ variable_to_change ].get_value()
-						    && std::find( domain_to_explore.begin(), domain_to_explore.end(), model.variables[ variable_id ].get_value() ) != domain_to_explore.end()
-						    && std::find( model.variables[ variable_id ].get_full_domain().begin(),
-						                  model.variables[ variable_id ].get_full_domain().end(),
-						                  model.variables[ variable_to_change ].get_value() ) != model.variables[ variable_id ].get_full_domain().end() )
+					for( const auto candidate_value : domain_to_explore )
+						delta_errors[ candidate_value ].push_back( 0.0 );
+			}
+			else
+			{
+				for( int variable_id = 0 ; variable_id < data.number_variables; ++variable_id )
+					// look at other variables than the selected one, with other values but contained into the selected variable's domain
+					if( variable_id != variable_to_change
+					    && model.variables[ variable_id ].get_value() != model.variables[ variable_to_change ].get_value()
+					    && std::find( domain_to_explore.begin(), domain_to_explore.end(), model.variables[ variable_id ].get_value() ) != domain_to_explore.end()
+					    && std::find( model.variables[ variable_id ].get_full_domain().begin(),
+					                  model.variables[ variable_id ].get_full_domain().end(),
+					                  model.variables[ variable_to_change ].get_value() ) != model.variables[ variable_id ].get_full_domain().end() )
+					{
+						// Abandon a partially evaluated neighborhood: no moves are made on incomplete deltas
+						if( must_interrupt() )
+						{
+							++data.interrupted_iterations;
+							return;
+						}
+
+						std::vector<bool> constraint_checked( data.number_constraints, false );
+						int current_value = model.variables[ variable_to_change ].get_value();
+						int candidate_value = model.variables[ variable_id ].get_value();
+						auto& deltas = delta_errors[ variable_id ];
+
+						for( const int constraint_id : data.matrix_var_ctr.at( variable_to_change ) )
 						{
-							std::vector<bool> constraint_checked( data.number_constraints, false );
-							int current_value = model.variables[ variable_to_change ].get_value();
-							int candidate_value = model.variables[ variable_id ].get_value();
+							constraint_checked[ constraint_id ] = true;
 
-							for( const int constraint_id : data.matrix_var_ctr.at( variable_to_change ) )
+							// check if the other variable also belongs to the constraint scope
+							if( model.constraints[ constraint_id ]->has_variable( variable_id ) )
 							{
-								constraint_checked[ constraint_id ] = true;
-
-								// check if the other variable also belongs to the constraint scope
-								if( model.constraints[ constraint_id ]->has_variable( variable_id ) )
-									delta_errors[ variable_id ].push_back( model.constraints[ constraint_id ]->simulate_delta( std::vector<int>{variable_to_change, variable_id},
-										                     std::vector<int>{candidate_value, current_value} ) );
-								else
-									delta_errors[ variable_id ].push_back( model.constraints[ constraint_id ]->simulate_delta( std::vector<int>{variable_to_change},
-										                     std::vector<int>{candidate_value} ) );
+								// Swapping two variables of a permutation-invariant constraint cannot change its error
+								if( !model.constraints[ constraint_id ]->_is_permutation_invariant )
+									deltas.push_back( model.constraints[ constraint_id ]->simulate_delta( std::vector<int>{variable_to_change, variable_id},
+									                                                                      std::vector<int>{candidate_value, current_value} ) );
 							}
-
-							// Since we are switching the value of two variables, we need to also look at the delta error impact of changing the value of the non-selected variable
-							for( const int constraint_id : data.matrix_var_ctr.at( variable_id ) )
-								// No need to look at constraint where variable_to_change also appears.
-								if( !constraint_checked[ constraint_id ] )
-									delta_errors[ variable_id ].push_back( model.constraints[ constraint_id ]->simulate_delta( std::vector<int>{variable_id},
-										                     std::vector<int>{current_value} ) );
+							else
+								deltas.push_back( model.constraints[ constraint_id ]->simulate_delta( std::vector<int>{variable_to_change},
+									                     std::vector<int>{candidate_value} ) );
 						}
-				}
 
-				// Select the next current configuration (local move)
-				double min_conflict = std::numeric_limits<double>::max();
-				int new_value = value_heuristic->select_value_candidates( variable_to_change, data, model, delta_errors, min_conflict, rng );
+						// Since we are switching the value of two variables, we need to also look at the delta error impact of changing the value of the non-selected variable
+						for( const int constraint_id : data.matrix_var_ctr.at( variable_id ) )
+							// No need to look at constraint where variable_to_change also appears.
+							if( !constraint_checked[ constraint_id ] )
+								deltas.push_back( model.constraints[ constraint_id ]->simulate_delta( std::vector<int>{variable_id},
+									                     std::vector<int>{current_value} ) );
+					}
+			}
 
-				
+			variable_candidates.remove( variable_to_change );
+
+			// Select the next current configuration (local move)
+			double min_conflict = std::numeric_limits<double>::max();
+			int new_value = value_heuristic->select_value_candidates( variable_to_change, data, model, delta_errors, min_conflict, rng );
+
+			
 #if defined GHOST_TRACE
-				std::vector<int> candidate_values;
-				std::map<int, double> cumulated_delta_errors;
-				std::vector<double> cumulated_delta_errors_antidote( delta_errors.size() );
-				std::vector<double> cumulated_delta_errors_for_distribution( delta_errors.size() );
-				std::vector<int> cumulated_delta_errors_variable_index_correspondance( delta_errors.size() );
-				int index = 0;
+			std::vector<int> candidate_values;
+			std::map<int, double> cumulated_delta_errors;
+			std::vector<double> cumulated_delta_errors_antidote( delta_errors.size() );
+			std::vector<double> cumulated_delta_errors_for_distribution( delta_errors.size() );
+			std::vector<int> cumulated_delta_errors_variable_index_correspondance( delta_errors.size() );
+			int index = 0;
+			
+			for( const auto& deltas : delta_errors )
+			{
+				cumulated_delta_errors[ deltas.first ] = std::accumulate( deltas.second.begin(), deltas.second.end(), 0.0 );
+				cumulated_delta_errors_antidote[ index ] = cumulated_delta_errors[ deltas.first ];
+				cumulated_delta_errors_variable_index_correspondance[ index ] = deltas.first;
 				
-				for( const auto& deltas : delta_errors )
+				if( model.permutation_problem )
 				{
-					cumulated_delta_errors[ deltas.first ] = std::accumulate( deltas.second.begin(), deltas.second.end(), 0.0 );
-					cumulated_delta_errors_antidote[ index ] = cumulated_delta_errors[ deltas.first ];
-					cumulated_delta_errors_variable_index_correspondance[ index ] = deltas.first;
-					
-					if( model.permutation_problem )
-					{
-						COUT << "(Meaningful with Adaptive Search Value Heuristic only) Error for switching var[" << variable_to_change << "]=" << model.variables[ variable_to_change ].get_value()
-						     << " with var[" << deltas.first << "]=" << model.variables[ deltas.first ].get_value()
-						     << ": " << cumulated_delta_errors[ deltas.first ] << "\n";
-						double transformed = cumulated_delta_errors_antidote[ index ] >= 0 ? 0.0 : -cumulated_delta_errors_antidote[ index ];
-						COUT << "(Meaningful with Antidote Search Value Heuristic only) Error for switching var[" << variable_to_change << "]=" << model.variables[ variable_to_change ].get_value()
-						     << " with var[" << deltas.first << "]=" << model.variables[ deltas.first ].get_value()
-						     << ": " << cumulated_delta_errors_antidote[ index ] << ", transformed: " << transformed << "\n";
-					}
-					else
-					{
-						COUT << "(Meaningful with Adaptive Search Value Heuristic only) Error for the value " << deltas.first << ": " << cumulated_delta_errors[ deltas.first ] << "\n";
-						COUT << "(Meaningful with Antidote Search Value Heuristic only) Error for the value " << deltas.first << ": " << cumulated_delta_errors_antidote[ index ] << "\n";
-					}
-					++index;
+					COUT << "(Meaningful with Adaptive Search Value Heuristic only) Error for switching var[" << variable_to_change << "]=" << model.variables[ variable_to_change ].get_value()
+					     << " with var[" << deltas.first << "]=" << model.variables[ deltas.first ].get_value()
+					     << ": " << cumulated_delta_errors[ deltas.first ] << "\n";
+					double transformed = cumulated_delta_errors_antidote[ index ] >= 0 ? 0.0 : -cumulated_delta_errors_antidote[ index ];
+					COUT << "(Meaningful with Antidote Search Value Heuristic only) Error for switching var[" << variable_to_change << "]=" << model.variables[ variable_to_change ].get_value()
+					     << " with var[" << deltas.first << "]=" << model.variables[ deltas.first ].get_value()
+					     << ": " << cumulated_delta_errors_antidote[ index ] << ", transformed: " << transformed << "\n";
 				}
-				
-				std::transform( cumulated_delta_errors_antidote.begin(),
-				                cumulated_delta_errors_antidote.end(),
-				                cumulated_delta_errors_for_distribution.begin(),
-				                []( auto delta ){ if( delta >= 0) return 0.0; else return -delta; } );
-				
-				for( const auto& deltas : cumulated_delta_errors )
+				else
 				{
-					if( min_conflict > deltas.second )
-					{
-						candidate_values.clear();
-						candidate_values.push_back( deltas.first );
-						min_conflict = deltas.second;
-					}
-					else
-						if( min_conflict == deltas.second )
-							candidate_values.push_back( deltas.first );
+					COUT << "(Meaningful with Adaptive Search Value Heuristic only) Error for the value " << deltas.first << ": " << cumulated_delta_errors[ deltas.first ] << "\n";
+					COUT << "(Meaningful with Antidote Search Value Heuristic only) Error for the value " << deltas.first << ": " << cumulated_delta_errors_antidote[ index ] << "\n";
+				}
+				++index;
+			}
+			
+			std::transform( cumulated_delta_errors_antidote.begin(),
+			                cumulated_delta_errors_antidote.end(),
+			                cumulated_delta_errors_for_distribution.begin(),
+			                []( auto delta ){ if( delta >= 0) return 0.0; else return -delta; } );
+			
+			for( const auto& deltas : cumulated_delta_errors )
+			{
+				if( min_conflict > deltas.second )
+				{
+					candidate_values.clear();
+					candidate_values.push_back( deltas.first );
+					min_conflict = deltas.second;
 				}
-				
-				COUT << "(Meaningful with Adaptive Search Value Heuristic only) Min conflict value candidates list: " << candidate_values[0];
-				for( int i = 1 ; i < static_cast<int>( candidate_values.size() ); ++i )
-					COUT << ", " << candidate_values[i];
-
-				auto distrib_value = std::discrete_distribution<int>( cumulated_delta_errors_for_distribution.begin(), cumulated_delta_errors_for_distribution.end() );
-				std::vector<int> vec_value( domain_to_explore.size(), 0 );
-				for( int n = 0 ; n < 10000 ; ++n )
-					++vec_value[ rng.variate<int, std::discrete_distribution>( distrib_value ) ];
-				std::vector<std::pair<int,int>> vec_value_pair( domain_to_explore.size() );
-				for( int n = 0 ; n < domain_to_explore.size() ; ++n )
-					vec_value_pair[n] = std::make_pair( cumulated_delta_errors_variable_index_correspondance[n], vec_value[n] );
-				std::sort( vec_value_pair.begin(), vec_value_pair.end(), [&](std::pair<int, int> &a, std::pair<int, int> &b){ return a.second > b.second; } );
-				COUT << "\n(Meaningful with Antidote Search Value Heuristic only) Cumulated delta error distribution (normalized):\n";
-				for( int n = 0 ; n < domain_to_explore.size() ; ++n )
-					COUT << "value " <<  vec_value_pair[ n ].first << " => " << std::fixed << std::setprecision(3) << static_cast<double>( vec_value_pair[ n ].second ) / 10000 << "\n";
-				
-				if( model.permutation_problem )
-					COUT << "\nPicked variable index for min conflict: "
-					     << new_value << "\n"
-					     << "Current error: " << data.current_sat_error << "\n"
-					     << "Delta: " << min_conflict << "\n\n";
 				else
-					COUT << "\nPicked value for min conflict: "
-					     << new_value << "\n"
-					     << "Current error: " << data.current_sat_error << "\n"
-					     << "Delta: " << min_conflict << "\n\n";
+					if( min_conflict == deltas.second )
+						candidate_values.push_back( deltas.first );
+			}
+			
+			COUT << "(Meaningful with Adaptive Search Value Heuristic only) Min conflict value candidates list: " << candidate_values[0];
+			for( int i = 1 ; i < static_cast<int>( candidate_values.size() ); ++i )
+				COUT << ", " << candidate_values[i];
+
+			auto distrib_value = std::discrete_distribution<int>( cumulated_delta_errors_for_distribution.begin(), cumulated_delta_errors_for_distribution.end() );
+			std::vector<int> vec_value( domain_to_explore.size(), 0 );
+			for( int n = 0 ; n < 10000 ; ++n )
+				++vec_value[ rng.variate<int, std::discrete_distribution>( distrib_value ) ];
+			std::vector<std::pair<int,int>> vec_value_pair( domain_to_explore.size() );
+			for( int n = 0 ; n < domain_to_explore.size() ; ++n )
+				vec_value_pair[n] = std::make_pair( cumulated_delta_errors_variable_index_correspondance[n], vec_value[n] );
+			std::sort( vec_value_pair.begin(), vec_value_pair.end(), [&](std::pair<int, int> &a, std::pair<int, int> &b){ return a.second > b.second; } );
+			COUT << "\n(Meaningful with Antidote Search Value Heuristic only) Cumulated delta error distribution (normalized):\n";
+			for( int n = 0 ; n < domain_to_explore.size() ; ++n )
+				COUT << "value " <<  vec_value_pair[ n ].first << " => " << std::fixed << std::setprecision(3) << static_cast<double>( vec_value_pair[ n ].second ) / 10000 << "\n";
+			
+			if( model.permutation_problem )
+				COUT << "\nPicked variable index for min conflict: "
+				     << new_value << "\n"
+				     << "Current error: " << data.current_sat_error << "\n"
+				     << "Delta: " << min_conflict << "\n\n";
+			else
+				COUT << "\nPicked value for min conflict: "
+				     << new_value << "\n"
+				     << "Current error: " << data.current_sat_error << "\n"
+				     << "Delta: " << min_conflict << "\n\n";
 #endif // GHOST_TRACE
 
-				/****************************************
-				 * 3. Error improved => make local move *
-				 ****************************************/
-				if( min_conflict < 0.0 )
+			/**********************************************************
+			 * 2.b. Error not improved => explore other neighborhoods *
+			 *********************************************************/
+			if( min_conflict >= 0.0 && !options.neighborhoods.empty() )
+			{
+				if( explore_neighborhoods( variable_to_change ) )
 				{
 #if defined GHOST_TRACE
-					COUT << "Global error improved (" << data.current_sat_error << " -> " << data.current_sat_error + min_conflict << "): make local move.\n";
+					COUT << "Improving move found in another neighborhood.\n";
 #endif
-					local_move( variable_to_change, new_value, min_conflict, delta_errors );
-					if( data.is_optimization )
+					update_best_solution();
+					return;
+				}
+
+				if( must_interrupt() )
+				{
+					++data.interrupted_iterations;
+					return;
+				}
+			}
+
+			/****************************************
+			 * 3. Error improved => make local move *
+			 ****************************************/
+			if( min_conflict < 0.0 )
+			{
+#if defined GHOST_TRACE
+				COUT << "Global error improved (" << data.current_sat_error << " -> " << data.current_sat_error + min_conflict << "): make local move.\n";
+#endif
+				if( data.is_optimization )
+				{
+					if( model.objective->_is_optional_delta_cost_defined && data.current_opt_cost != std::numeric_limits<double>::max() )
+					{
+						data.current_opt_cost += compute_objective_delta_cost( variable_to_change, new_value );
+						local_move( variable_to_change, new_value, min_conflict, delta_errors );
+					}
+					else
+					{
+						local_move( variable_to_change, new_value, min_conflict, delta_errors );
 						data.current_opt_cost = model.objective->cost();
+					}
 				}
 				else
+					local_move( variable_to_change, new_value, min_conflict, delta_errors );
+			}
+			else
+			{
+				/*****************
+				 * 4. Same error *
+				 *****************/
+				if( min_conflict == 0.0 )
 				{
-					/*****************
-					 * 4. Same error *
-					 *****************/
-					if( min_conflict == 0.0 )
-					{
 #if defined GHOST_TRACE
-						COUT << "Global error stable; ";
+					COUT << "Global error stable; ";
 #endif
-						if( data.is_optimization )
+					if( data.is_optimization )
+					{
+						double candidate_opt_cost;
+						if( model.objective->_is_optional_delta_cost_defined )
 						{
-							double candidate_opt_cost;
-							if( model.permutation_problem )
-							{
-								int backup_variable_to_change = model.variables[ variable_to_change ].get_value();
-								int backup_variable_new_value = model.variables[ new_value ].get_value();
+							// The current cost is unknown as long as no move has been done after a (re)initialization
+							// with a non-zero satisfaction error
+							if( data.current_opt_cost == std::numeric_limits<double>::max() )
+								data.current_opt_cost = model.objective->cost();
 
-								model.variables[ variable_to_change ].set_value( backup_variable_new_value );
-								model.variables[ new_value ].set_value( backup_variable_to_change );
+							candidate_opt_cost = data.current_opt_cost + compute_objective_delta_cost( variable_to_change, new_value );
+						}
+						else if( model.permutation_problem )
+						{
+							int backup_variable_to_change = model.variables[ variable_to_change ].get_value();
+							int backup_variable_new_value = model.variables[ new_value ].get_value();
 
-								model.auxiliary_data->update( variable_to_change, backup_variable_new_value );
-								model.auxiliary_data->update( new_value, backup_variable_to_change );
+							model.variables[ variable_to_change ].set_value( backup_variable_new_value );
+							model.variables[ new_value ].set_value( backup_variable_to_change );
 
-								candidate_opt_cost = model.objective->cost();
+							model.auxiliary_data->update( variable_to_change, backup_variable_new_value );
+							model.auxiliary_data->update( new_value, backup_variable_to_change );
 
-								model.variables[ variable_to_change ].set_value( backup_variable_to_change );
-								model.variables[ new_value ].set_value( backup_variable_new_value );
+							candidate_opt_cost = model.objective->cost();
 
-								model.auxiliary_data->update( variable_to_change, backup_variable_to_change );
-								model.auxiliary_data->update( new_value, backup_variable_new_value );
-							}
-							else
-							{
-								int backup = model.variables[ variable_to_change ].get_value();
+							model.variables[ variable_to_change ].set_value( backup_variable_to_change );
+							model.variables[ new_value ].set_value( backup_variable_new_value );
 
-								model.variables[ variable_to_change ].set_value( new_value );
-								model.auxiliary_data->update( variable_to_change, new_value );
+							model.auxiliary_data->update( variable_to_change, backup_variable_to_change );
+							model.auxiliary_data->update( new_value, backup_variable_new_value );
+						}
+						else
+						{
+							int backup = model.variables[ variable_to_change ].get_value();
 
-								candidate_opt_cost = model.objective->cost();
+							model.variables[ variable_to_change ].set_value( new_value );
+							model.auxiliary_data->update( variable_to_change, new_value );
 
-								model.variables[ variable_to_change ].set_value( backup );
-								model.auxiliary_data->update( variable_to_change, backup );
-							}
+							candidate_opt_cost = model.objective->cost();
 
-							/******************************************************
-							 * 4.a. Optimization cost improved => make local move *
-							 ******************************************************/
-							if( data.current_opt_cost > candidate_opt_cost )
-							{
-#if defined GHOST_TRACE
-								COUT << "optimization cost improved (" << data.current_opt_cost << " -> " << candidate_opt_cost << "): make local move.\n";
-#endif
-								local_move( variable_to_change, new_value, min_conflict, delta_errors );
-								data.current_opt_cost = candidate_opt_cost;
-							}
-							else
-								/******************************************
-								 * 4.b. Same optimization cost => plateau *
-								 ******************************************/
-								if( data.current_opt_cost == candidate_opt_cost )
-								{
-#if defined GHOST_TRACE
-									COUT << "optimization cost stable (" << data.current_opt_cost << "): plateau.\n";
-#endif
-									plateau_management( variable_to_change, new_value, delta_errors );
-								}
-								else // data.current_opt_cost < candidate_opt_cost
-								{
-									/*************************************************
-									 * 4.c. Worst optimization cost => local minimum *
-									 *************************************************/
+							model.variables[ variable_to_change ].set_value( backup );
+							model.auxiliary_data->update( variable_to_change, backup );
+						}
+
+						/******************************************************
+						 * 4.a. Optimization cost improved => make local move *
+						 ******************************************************/
+						if( data.current_opt_cost > candidate_opt_cost )
+						{
 #if defined GHOST_TRACE
-									COUT << "optimization cost increase (" << data.current_opt_cost << " -> " << candidate_opt_cost << "): local minimum.\n";
+							COUT << "optimization cost improved (" << data.current_opt_cost << " -> " << candidate_opt_cost << "): make local move.\n";
 #endif
-									local_minimum_management( variable_to_change, new_value, variable_candidates.empty() );
-								}
+							local_move( variable_to_change, new_value, min_conflict, delta_errors );
+							data.current_opt_cost = candidate_opt_cost;
 						}
 						else
-						{
-							/***********************************************
-							 * 4.d. Not an optimization problem => plateau *
-							 ***********************************************/
+							/******************************************
+							 * 4.b. Same optimization cost => plateau *
+							 ******************************************/
+							if( data.current_opt_cost == candidate_opt_cost )
+							{
 #if defined GHOST_TRACE
-							COUT << "no optimization: plateau.\n";
+								COUT << "optimization cost stable (" << data.current_opt_cost << "): plateau.\n";
 #endif
-							plateau_management( variable_to_change, new_value, delta_errors );
-						}
+								plateau_management( variable_to_change, new_value, delta_errors );
+							}
+							else // data.current_opt_cost < candidate_opt_cost
+							{
+								/*************************************************
+								 * 4.c. Worst optimization cost => local minimum *
+								 *************************************************/
+#if defined GHOST_TRACE
+								COUT << "optimization cost increase (" << data.current_opt_cost << " -> " << candidate_opt_cost << "): local minimum.\n";
+#endif
+								local_minimum_management( variable_to_change, new_value, variable_candidates.empty() );
+							}
 					}
-					else // min_conflict > 0.0
+					else
 					{
-						/***********************************
-						 * 5. Worst error => local minimum *
-						 ***********************************/
+						/***********************************************
+						 * 4.d. Not an optimization problem => plateau *
+						 ***********************************************/
 #if defined GHOST_TRACE
-						COUT << "Global error increase: local minimum.\n";
+						COUT << "no optimization: plateau.\n";
 #endif
-						local_minimum_management( variable_to_change, new_value, variable_candidates.empty() );
+						plateau_management( variable_to_change, new_value, delta_errors );
 					}
 				}
-
-				if( data.best_sat_error > data.current_sat_error )
+				else // min_conflict > 0.0
 				{
+					/***********************************
+					 * 5. Worst error => local minimum *
+					 ***********************************/
 #if defined GHOST_TRACE
-					COUT << "Best satisfaction error so far (in an optimization problem). Before: " << data.best_sat_error << ", now: " << data.current_sat_error << "\n";
+					COUT << "Global error increase: local minimum.\n";
 #endif
-					data.best_sat_error = data.current_sat_error;
-					std::transform( model.variables.begin(),
-					                model.variables.end(),
-					                final_solution.begin(),
-					                [&](auto& var){ return var.get_value(); } );
+					local_minimum_management( variable_to_change, new_value, variable_candidates.empty() );
 				}
-				else
-					if( data.is_optimization && data.current_sat_error == 0.0 && data.best_opt_cost > data.current_opt_cost )
-					{
+			}
+
+			update_best_solution();
+		}
+
+	public:
+		Model model;
+
+		std::vector<Variable> variables_at_start;
+		randutils::mt19937_rng rng;
+
+		SearchUnitData data;
+		std::unique_ptr<algorithms::VariableHeuristic> variable_heuristic;
+		std::unique_ptr<algorithms::VariableCandidatesHeuristic> variable_candidates_heuristic;
+		std::unique_ptr<algorithms::ValueHeuristic> value_heuristic;
+		std::unique_ptr<algorithms::ErrorProjection> error_projection_heuristic;
+				
+		std::vector<int> final_solution; // Best assignment found so far, once materialize_best_solution is called
+		std::vector<int> journal_base; // Assignment when the journal started
+		std::vector<std::pair<int,int>> journal; // (variable ID, value) pairs assigned by moves since the journal started
+		int best_journal_length; // Length of the journal when the best assignment was found, -1 if it is in final_solution
+		std::vector<int> sampling_batch; // Batch of starting samplings, reused from one call to set_initial_configuration to the next
+
+		algorithms::VariableCandidates variable_candidates;
+		bool must_compute_variable_candidates;
+		bool configuration_checking; // True iff variable_candidates_heuristic relies on data.configuration_changed
+
+		std::promise<bool> solution_found;
+
+		Options options;
+
+		SearchUnit( Model&& moved_model,
+		            const Options& options,
+		            std::unique_ptr<algorithms::VariableHeuristic> variable_heuristic,
+		            std::unique_ptr<algorithms::VariableCandidatesHeuristic> variable_candidates_heuristic,
+		            std::unique_ptr<algorithms::ValueHeuristic> value_heuristic,
+		            std::unique_ptr<algorithms::ErrorProjection> error_projection_heuristic )
+			: _stop_search_check( _stop_search_signal.get_future() ),
+			  _deadline( std::chrono::time_point<std::chrono::steady_clock>::max() ),
+			  _interruption_period( 1 ),
+			  _interruption_countdown( 0 ),
+			  _last_interruption_check( std::chrono::steady_clock::now() ),
+			  _last_improvement_iteration( 0 ),
+			  _time_budget( 0 ),
+			  model( std::move( moved_model ) ),
+			  data( model ),
+			  variable_heuristic( std::move( variable_heuristic ) ),
+			  variable_candidates_heuristic( std::move( variable_candidates_heuristic ) ),
+			  value_heuristic( std::move( value_heuristic ) ),
+			  error_projection_heuristic( std::move( error_projection_heuristic ) ),
+			  final_solution( std::vector<int>( data.number_variables, 0 ) ),
+			  journal_base( std::vector<int>( data.number_variables, 0 ) ),
+			  journal(),
+			  best_journal_length( -1 ),
+			  sampling_batch(),
+			  variable_candidates(), 
+			  must_compute_variable_candidates ( true ),
+			  configuration_checking( dynamic_cast<algorithms::ConfigurationCheckingVariableCandidatesHeuristic*>( this->variable_candidates_heuristic.get() ) != nullptr ),
+			  options ( options )
+		{
+			if( configuration_checking )
+				data.configuration_changed.assign( data.number_variables, true );
+
+			std::transform( model.variables.begin(),
+			                model.variables.end(),
+			                std::back_inserter( variables_at_start ),
+			                [&]( auto& v){ return v; } );
+
+			initialize_data_structures( model );
+			data.initialize_matrix( model );
+
+			this->error_projection_heuristic->set_number_variables( data.number_variables );
+			this->error_projection_heuristic->set_number_constraints( data.number_constraints );
+			this->error_projection_heuristic->initialize_data_structures();
+
 #if defined GHOST_TRACE
-						COUT << "Best objective function value so far. Before: " << data.best_opt_cost << ", now: " << data.current_opt_cost << "\n";
+			COUT << "Creating a Solver object\n\n"
+			     << "Variables:\n";
+
+			for( const auto& variable : model.variables )
+				COUT << variable << "\n";
+
+			COUT << "\nConstraints:\n";
+			for( auto constraint : model.constraints )
+				COUT << *constraint << "\n";
+
+			COUT << "\nObjective function:\n"
+			     << *(model.objective) << "\n";
 #endif
-						data.best_opt_cost = data.current_opt_cost;
-						std::transform( model.variables.begin(),
-						                model.variables.end(),
-						                final_solution.begin(),
-						                [&](auto& var){ return var.get_value(); } );
-					}
+		}
 
-				elapsed_time = std::chrono::steady_clock::now() - start;
-			} // while loop
+		SearchUnit( Model&& moved_model, const Options& options )
+			: SearchUnit( std::move( moved_model ),
+			              options,
+			              std::make_unique<algorithms::AdaptiveSearchVariableHeuristic>(),
+			              options.configuration_checking
+			              ? std::unique_ptr<algorithms::VariableCandidatesHeuristic>( std::make_unique<algorithms::ConfigurationCheckingVariableCandidatesHeuristic>() )
+			              : std::make_unique<algorithms::AdaptiveSearchVariableCandidatesHeuristic>(),
+			              std::make_unique<algorithms::AdaptiveSearchValueHeuristic>(),
+			              std::make_unique<algorithms::AdaptiveSearchErrorProjection>() )
+		{ }
 
+		
+		// Check if the thread must stop search
+		bool stop_search_requested()
+		{
+			if( _stop_search_check.wait_for( std::chrono::microseconds( 0 ) ) == std::future_status::ready )
+				return true;
+			else
+				return false;
+		}
+
+		void get_thread_id( std::thread::id id )
+		{
+			_thread_id = id;
+#if defined GHOST_TRACE_PARALLEL
+			_log_filename << "test_run_parallel_" << _thread_id << ".txt";
+			_log_trace.open( _log_filename.str() );
+#endif
+
+#if defined GHOST_TRACE
+			COUT << "Creating a search unit for thread number " << _thread_id << "\n";
+#endif
+		}
+
+		// Request the thread to stop searching
+		inline void stop_search()	{	_stop_search_signal.set_value(); }
+		inline Model&& transfer_model() { return std::move( model ); }
+
+		// Memory taken by the model and the inner data structures of the search unit
+		MemoryUsage memory_usage() const
+		{
+			MemoryUsage usage;
+			usage.add( "model", model.memory_usage() );
+
+			usage.add( "variables at start", MemoryUsage::heap_bytes( variables_at_start ) );
+			for( const auto& variable : variables_at_start )
+				usage.add( "variables at start", MemoryUsage::heap_bytes( variable._domain ) + MemoryUsage::heap_bytes( variable._name ) );
+
+			usage.add( "variable-constraint incidence", MemoryUsage::heap_bytes( data.matrix_var_ctr ) );
+			usage.add( "search data", MemoryUsage::heap_bytes( data.tabu_list )
+			                          + MemoryUsage::heap_bytes( data.configuration_changed )
+			                          + MemoryUsage::heap_bytes( data.error_variables )
+			                          + MemoryUsage::heap_bytes( final_solution )
+			                          + MemoryUsage::heap_bytes( journal_base )
+			                          + MemoryUsage::heap_bytes( journal )
+			                          + MemoryUsage::heap_bytes( sampling_batch )
+			                          + variable_candidates.memory_usage() );
+			usage.add( "error projection", error_projection_heuristic->memory_usage() );
+
+			return usage;
+		}
+
+		// Start a new search: (re)initialize variable values and data structures, without searching yet.
+		// The search can then be run slice by slice with step, and closed with end.
+		void begin()
+		{
+			data.best_sat_error = std::numeric_limits<double>::max();
+			data.best_opt_cost = std::numeric_limits<double>::max();
+			record_improvement();
+
+			initialize_variable_values();
+			initialize_data_structures();
+
+			// Starting samplings may have lowered data.best_sat_error down to the error of the starting assignment
+			record_best_solution();
+		}
+
+		// True iff a solution with an objective function value at least as good as options.target_cost has been found.
+		bool target_reached() const
+		{
+			if( !data.is_optimization || data.best_sat_error > 0.0 || std::isnan( options.target_cost ) )
+				return false;
+
+			// best_opt_cost is the cost to minimize, i.e., the opposite of the objective function value for maximization problems
+			return data.best_opt_cost <= ( model.objective->is_maximization() ? -options.target_cost : options.target_cost );
+		}
+
+		// True iff the search is not over, i.e., no stop has been requested and the solver either
+		// didn't satisfy all constraints or is working on an optimization problem, with its target cost
+		// not reached yet and its best solution not stagnating.
+		bool search_must_continue()
+		{
+			if( stop_search_requested() )
+				return false;
+
+			if( data.best_sat_error > 0.0 )
+				return true;
+
+			return data.is_optimization && !target_reached() && !is_stagnating();
+		}
+
+		// Resume the search started by begin for at most max_iterations iterations.
+		// All search states are kept between two calls.
+		// Return true iff the search must continue.
+		bool step( int max_iterations )
+		{
+			_deadline = std::chrono::time_point<std::chrono::steady_clock>::max();
+
+			for( int iteration = 0 ; iteration < max_iterations && search_must_continue() ; ++iteration )
+				search_iteration();
+
+			return search_must_continue();
+		}
+
+		// Resume the search started by begin until the given deadline is reached.
+		// The deadline is also checked within iterations, which are abandoned if needed.
+		// All search states are kept between two calls.
+		// Return true iff the search must continue.
+		bool step( std::chrono::time_point<std::chrono::steady_clock> deadline )
+		{
+			_deadline = deadline;
+
+			while( search_must_continue() && std::chrono::steady_clock::now() < _deadline )
+				search_iteration();
+
+			record_deadline_overshoot();
+			return search_must_continue();
+		}
+
+		// Best candidate or solution found so far.
+		inline const std::vector<int>& best()
+		{
+			materialize_best_solution();
+			return final_solution;
+		}
+
+		// Close the search: set variables to the best candidate or solution found and
+		// fulfill the solution_found promise. Must be called only once per search.
+		void end()
+		{
+			materialize_best_solution();
 			for( int i = 0 ; i < data.number_variables ; ++i )
 				model.variables[i].set_value( final_solution[i] );
 
@@ -1018,5 +1725,49 @@ namespace ghost
 			_log_trace.close();
 #endif
 		}
+
+		// Method doing the search; called by Solver::solve (eventually in several threads).
+		// Equivalent to begin, then step until the timeout, then end.
+		void search( double timeout )
+		{
+			// TODO: Antidote search
+			// TODO: Neighborhood
+
+			// 1. Choice of worst variable(s) to change
+			// 2. Choice of their new value
+			// 3. Error improved => make local move
+			// 4. Same error
+			// 4.a. Optimization cost improved => make local move
+			// 4.b. Same optimization cost => plateau
+			// 4.c. Worst optimization cost => local minimum
+			// 4.d. Not an optimization problem => plateau
+			// 5. Worst error => local minimum
+
+			// A. Local move (perform local move and update variables/constraints/objective function)
+			// B. Plateau management (local move on the plateau, but x% of chance to escape it, mark the variable as tabu.)
+			// C. local minimum management (if there are no other worst variables to try, mark the variable as tabu.
+			//                              Otherwise try them first, but with x% of chance, the solver fianlly marks the variable as tabu.)
+
+			std::chrono::time_point<std::chrono::steady_clock> start( std::chrono::steady_clock::now() );
+			std::chrono::duration<double,std::micro> budget( timeout );
+			_time_budget = budget;
+
+			// Avoid overflows with huge timeouts
+			if( budget < std::chrono::time_point<std::chrono::steady_clock>::max() - start )
+				_deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>( budget );
+			else
+				_deadline = std::chrono::time_point<std::chrono::steady_clock>::max();
+
+			// Start samplings are also bounded by the deadline
+			begin();
+
+			// While timeout is not reached, and the solver didn't satisfied all constraints
+			// OR
+			// it is working on an optimization problem,
+			// continue the search.
+			step( _deadline );
+
+			end();
+		}
 	};
 }
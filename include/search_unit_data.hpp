@@ -55,6 +55,11 @@ namespace ghost
 		// tabu_list[6] = 0 --> variable with id=6 is not marked as tabu (therefore, it is selectable during the search process)
 		std::vector<int> tabu_list;
 
+		// Configuration checking: to know if the configuration around each variable changed since its last move.
+		// Empty unless the search unit uses configuration checking.
+		// configuration_changed[2] = false --> variable with id=2 has been moved, and no variable sharing a constraint with it changed since then
+		std::vector<bool> configuration_changed;
+
 		// Variables about errors of the variables, and global satisfaction/optimization errors
 		std::vector<double> error_variables;
 		double best_sat_error;
@@ -70,6 +75,10 @@ namespace ghost
 		int local_minimum;
 		int plateau_moves;
 		int plateau_local_minimum;
+		int compound_moves; // local moves from Options::neighborhoods
+		int interrupted_iterations; // iterations abandoned because of a deadline or a stop request
+		double worst_deadline_overshoot; // in microseconds
+		int filtered_values; // candidate values whose delta errors were not simulated, thanks to plausible values
 
 		SearchUnitData( const Model& model )
 		: number_variables ( static_cast<int>( model.variables.size() ) ),
@@ -77,6 +86,7 @@ namespace ghost
 		  is_optimization ( model.objective->is_optimization() ),
 		  matrix_var_ctr ( number_variables ),
 		  tabu_list ( std::vector<int>( number_variables, 0 ) ),
+		  configuration_changed (),
 		  error_variables ( std::vector<double>( number_variables, 0.0 ) ),
 		  best_sat_error ( std::numeric_limits<double>::max() ),
 		  best_opt_cost ( std::numeric_limits<double>::max() ),
@@ -88,7 +98,11 @@ namespace ghost
 		  search_iterations ( 0 ),
 		  local_minimum ( 0 ),
 		  plateau_moves ( 0 ),
-		  plateau_local_minimum ( 0 )
+		  plateau_local_minimum ( 0 ),
+		  compound_moves ( 0 ),
+		  interrupted_iterations ( 0 ),
+		  worst_deadline_overshoot ( 0.0 ),
+		  filtered_values ( 0 )
 		{ }
 
 		void initialize_matrix( const Model& model )
@@ -41,6 +41,13 @@
 #include <iterator>
 #include <thread>
 #include <future>
+#include <utility>
+#include <exception>
+#include <atomic>
+
+#if defined __cpp_impl_coroutine && __has_include( <coroutine> )
+#include <coroutine>
+#endif
 
 #include "variable.hpp"
 #include "constraint.hpp"
@@ -55,6 +62,9 @@
 #include "algorithms/variable_candidates_heuristic.hpp"
 #include "algorithms/value_heuristic.hpp"
 #include "algorithms/error_projection_heuristic.hpp"
+#include "algorithms/multilevel.hpp"
+#include "algorithms/exhaustive_search.hpp"
+#include "algorithms/intensification.hpp"
 
 #include "algorithms/adaptive_search_variable_heuristic.hpp"
 #include "algorithms/adaptive_search_variable_candidates_heuristic.hpp"
@@ -129,6 +139,14 @@ namespace ghost
 		int _local_minimum;
 		int _plateau_moves;
 		int _plateau_local_minimum;
+		int _compound_moves;
+		int _interrupted_iterations;
+		double _worst_deadline_overshoot; // in microseconds
+		int _filtered_values;
+		int _number_coarse_levels; // coarse levels solved in multilevel mode
+		long long _enumerated_assignments; // assignments enumerated by exhaustive search, 0 if the search space was not enumerated
+		bool _search_space_exhausted; // true iff exhaustive search enumerated the whole search space
+		int _intensification_improvements; // moves done by the final intensification phase on the returned solution
 
 		std::string _variable_heuristic;
 		std::string _variable_candidates_heuristic;
@@ -137,6 +155,271 @@ namespace ghost
 		
 		Options _options; // Options for the solver (see the struct Options).
 
+		std::unique_ptr<SearchUnit> _stepping_unit; // Search unit of a search run step by step (see Solver::begin).
+		std::chrono::time_point<std::chrono::steady_clock> _stepping_start; // Wall-clock time of the last Solver::begin call.
+
+		// Copy the given options and set default values of unset options, for a model with the given number of variables.
+		Options complete_options( const Options& options, int number_variables ) const
+		{
+			Options completed_options( options );
+
+			if( completed_options.tabu_time_local_min < 0 )
+				completed_options.tabu_time_local_min = std::max( std::min( 5, static_cast<int>( number_variables ) - 1 ), static_cast<int>( std::ceil( number_variables / 5 ) ) ) + 1;
+			  //completed_options.tabu_time_local_min = std::max( 2, _tabu_threshold ) );
+
+			if( completed_options.tabu_time_selected < 0 )
+				completed_options.tabu_time_selected = 0;
+
+			if( completed_options.percent_chance_escape_plateau < 0 || completed_options.percent_chance_escape_plateau > 100 )
+				completed_options.percent_chance_escape_plateau = 10;
+
+			if( completed_options.reset_threshold < 0 )
+				completed_options.reset_threshold = completed_options.tabu_time_local_min;
+// 			completed_options.reset_threshold = static_cast<int>( std::ceil( 1.5 * completed_options.reset_threshold ) );
+//		  completed_options.reset_threshold = 2 * static_cast<int>( std::ceil( std::sqrt( number_variables ) ) );
+
+			if( completed_options.restart_threshold < 0 )
+				completed_options.restart_threshold = number_variables;
+
+			if( completed_options.number_variables_to_reset < 0 )
+				completed_options.number_variables_to_reset = std::max( 2, static_cast<int>( std::ceil( number_variables * 0.1 ) ) ); // 10%
+
+			if( completed_options.number_start_samplings < 0 )
+				completed_options.number_start_samplings = 10;
+
+			if( completed_options.multilevel_coarsest_size <= 0 )
+				completed_options.multilevel_coarsest_size = 100;
+
+			if( completed_options.multilevel_percent_budget < 0 || completed_options.multilevel_percent_budget > 100 )
+				completed_options.multilevel_percent_budget = 25;
+
+			if( completed_options.exhaustive_search_threshold < 0 )
+				completed_options.exhaustive_search_threshold = 0;
+
+			if( completed_options.intensification_percent_budget < 0 || completed_options.intensification_percent_budget > 100 )
+				completed_options.intensification_percent_budget = 0;
+
+			if( completed_options.intensification_top_k <= 0 )
+				completed_options.intensification_top_k = completed_options.number_threads;
+
+			return completed_options;
+		}
+
+		// Copy the given options and set default values of unset options.
+		// _number_variables must be known before calling this function.
+		void set_options( const Options& options )
+		{
+			_options = complete_options( options, _number_variables );
+		}
+
+		// Get stats and heuristic names of the given search unit.
+		void get_unit_statistics( const SearchUnit& unit )
+		{
+			_restarts = unit.data.restarts;
+			_resets = unit.data.resets;
+			_local_moves = unit.data.local_moves;
+			_search_iterations = unit.data.search_iterations;
+			_local_minimum = unit.data.local_minimum;
+			_plateau_moves = unit.data.plateau_moves;
+			_plateau_local_minimum = unit.data.plateau_local_minimum;
+			_compound_moves = unit.data.compound_moves;
+			_interrupted_iterations = unit.data.interrupted_iterations;
+			_worst_deadline_overshoot = unit.data.worst_deadline_overshoot;
+			_filtered_values = unit.data.filtered_values;
+
+			_variable_heuristic = unit.variable_heuristic->get_name();
+			_variable_candidates_heuristic = unit.variable_candidates_heuristic->get_name();
+			_value_heuristic = unit.value_heuristic->get_name();
+			_error_projection_heuristic = unit.error_projection_heuristic->get_name();
+		}
+
+		// Build a model for a search unit, starting from the given variable values if any.
+		Model build_unit_model( const std::vector<int>& starting_point )
+		{
+			Model model = _model_builder.build_model();
+			for( int variable_id = 0 ; variable_id < static_cast<int>( starting_point.size() ) ; ++variable_id )
+				model.variables[ variable_id ].set_value( starting_point[ variable_id ] );
+
+			return model;
+		}
+
+		// Multilevel mode: coarsen the model, solve its coarsest version, then project and refine the
+		// solution level by level within the given time budget, each level getting a share proportional
+		// to its number of variables. Return the solution projected on the model itself, or an empty
+		// vector if the model cannot be coarsened.
+		std::vector<int> solve_coarse_levels( const Options& options, double timeout )
+		{
+			std::chrono::time_point<std::chrono::steady_clock> start( std::chrono::steady_clock::now() );
+			std::chrono::duration<double,std::micro> elapsed_time( 0 );
+			std::vector<int> solution;
+
+			Model model = _model_builder.build_model();
+			if( model.permutation_problem || dynamic_cast<NullAuxiliaryData*>( model.auxiliary_data.get() ) == nullptr )
+				return solution;
+
+			randutils::mt19937_rng rng;
+			algorithms::Multilevel multilevel( std::move( model ), _options.multilevel_coarsest_size, rng );
+			_number_coarse_levels = multilevel.get_number_levels();
+
+			int remaining_variables = 0;
+			for( int level = 1 ; level <= _number_coarse_levels ; ++level )
+				remaining_variables += multilevel.get_number_variables( level );
+
+			for( int level = _number_coarse_levels ; level > 0 ; --level )
+			{
+				int number_variables = multilevel.get_number_variables( level );
+				Model level_model = multilevel.transfer_model( level );
+				Options level_options = complete_options( options, number_variables );
+
+				if( !solution.empty() )
+				{
+					for( int variable_id = 0 ; variable_id < number_variables ; ++variable_id )
+						level_model.variables[ variable_id ].set_value( solution[ variable_id ] );
+					level_options.custom_starting_point = true;
+				}
+
+				elapsed_time = std::chrono::steady_clock::now() - start;
+				double level_timeout = std::max( 0.0, ( timeout - elapsed_time.count() ) * number_variables / remaining_variables );
+				remaining_variables -= number_variables;
+
+				SearchUnit search_unit( std::move( level_model ), level_options );
+				search_unit.search( level_timeout );
+				solution = multilevel.project( level, search_unit.best() );
+			}
+
+			return solution;
+		}
+
+		// Exhaustive search: enumerate the search space of the model, of the given size, splitting
+		// it into one interval of assignments per thread for parallel runs. Keep the best assignment
+		// in _model. Return true iff a solution has been found.
+		bool solve_exhaustively( long long search_space_size, double timeout )
+		{
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>( std::chrono::duration<double,std::micro>( timeout ) );
+			int number_searches = _options.parallel_runs ? static_cast<int>( std::min<long long>( _options.number_threads, search_space_size ) ) : 1;
+			std::atomic<bool> stop( false );
+
+			std::vector<algorithms::ExhaustiveSearch> searches;
+			searches.reserve( number_searches );
+			for( int i = 0 ; i < number_searches ; ++i )
+				searches.emplace_back( _model_builder.build_model(), _options.target_cost );
+
+			auto first_rank = [&]( int i ){ return search_space_size * i / number_searches; };
+			if( number_searches == 1 )
+				searches[0].search( 0, search_space_size, deadline, stop );
+			else
+			{
+				std::vector<std::thread> search_threads;
+				for( int i = 0 ; i < number_searches ; ++i )
+					search_threads.emplace_back( &algorithms::ExhaustiveSearch::search, &searches[i], first_rank( i ), first_rank( i + 1 ), deadline, std::ref( stop ) );
+				for( auto& thread : search_threads )
+					thread.join();
+			}
+
+			// Best solution first, then best non-solution, like parallel runs
+			int best_search = 0;
+			_enumerated_assignments = 0;
+			_search_space_exhausted = true;
+			for( int i = 0 ; i < number_searches ; ++i )
+			{
+				_enumerated_assignments += searches[i].get_enumerated_assignments();
+				_search_space_exhausted = _search_space_exhausted && searches[i].is_exhausted();
+
+				if( searches[i].get_best_sat_error() < searches[ best_search ].get_best_sat_error()
+				    || ( searches[i].get_best_sat_error() == 0.0 && searches[ best_search ].get_best_sat_error() == 0.0 && searches[i].get_best_opt_cost() < searches[ best_search ].get_best_opt_cost() ) )
+					best_search = i;
+			}
+
+			_best_sat_error = searches[ best_search ].get_best_sat_error();
+			_best_opt_cost = searches[ best_search ].get_best_opt_cost();
+			_model = std::move( searches[ best_search ].transfer_model() );
+
+			_restarts = _resets = _local_moves = _search_iterations = _local_minimum = 0;
+			_plateau_moves = _plateau_local_minimum = _compound_moves = _interrupted_iterations = _filtered_values = 0;
+			_restarts_total = _resets_total = _local_moves_total = _search_iterations_total = _local_minimum_total = 0;
+			_plateau_moves_total = _plateau_local_minimum_total = 0;
+			_worst_deadline_overshoot = 0.0;
+			_variable_heuristic = _variable_candidates_heuristic = _value_heuristic = _error_projection_heuristic = "None (exhaustive search)";
+
+			return _best_sat_error == 0.0;
+		}
+
+		// Final intensification phase: improve the top-k distinct solutions among the given ones (with their
+		// optimization cost) by strict descent in parallel, until the deadline. Keep the best result in _model
+		// if it improves _best_opt_cost.
+		void intensify( std::vector<std::pair<double,std::vector<int>>>& solutions,
+		                std::chrono::time_point<std::chrono::steady_clock> deadline )
+		{
+			std::sort( solutions.begin(), solutions.end() );
+			solutions.erase( std::unique( solutions.begin(), solutions.end() ), solutions.end() );
+			if( static_cast<int>( solutions.size() ) > _options.intensification_top_k )
+				solutions.resize( _options.intensification_top_k );
+
+			std::vector<algorithms::Intensification> intensifications;
+			intensifications.reserve( solutions.size() );
+			for( const auto& solution : solutions )
+				intensifications.emplace_back( _model_builder.build_model(), solution.second );
+
+			if( intensifications.size() == 1 )
+				intensifications[0].search( deadline );
+			else
+			{
+				std::vector<std::thread> intensification_threads;
+				for( auto& intensification : intensifications )
+					intensification_threads.emplace_back( &algorithms::Intensification::search, &intensification, deadline );
+				for( auto& thread : intensification_threads )
+					thread.join();
+			}
+
+			auto best = std::min_element( intensifications.begin(),
+			                              intensifications.end(),
+			                              []( const auto& a, const auto& b ){ return a.get_opt_cost() < b.get_opt_cost(); } );
+
+			if( best->get_opt_cost() < _best_opt_cost )
+			{
+				_best_opt_cost = best->get_opt_cost();
+				_intensification_improvements = best->get_improvements();
+				_model = std::move( best->transfer_model() );
+			}
+		}
+
+		// Post-process the best optimization cost if a solution has been found, then write
+		// the final cost and the final solution from _model.
+		void write_final_values( double& final_cost,
+		                         std::vector<int>& final_solution,
+		                         bool solution_found,
+		                         bool is_optimization,
+		                         std::chrono::duration<double,std::micro>& timer_postprocess )
+		{
+			if( solution_found && is_optimization )
+			{
+				_cost_before_postprocess = _best_opt_cost;
+
+				std::chrono::time_point<std::chrono::steady_clock> start_postprocess( std::chrono::steady_clock::now() );
+				_best_opt_cost = _model.objective->postprocess( _best_opt_cost );
+				timer_postprocess = std::chrono::steady_clock::now() - start_postprocess;
+			}
+
+			if( is_optimization )
+			{
+				if( _best_opt_cost < 0 )
+				{
+					_best_opt_cost = -_best_opt_cost;
+					_cost_before_postprocess = -_cost_before_postprocess;
+				}
+
+				final_cost = _best_opt_cost;
+			}
+			else
+				final_cost = _best_sat_error;
+
+			final_solution.resize( _number_variables );
+			std::transform( _model.variables.begin(),
+			                _model.variables.end(),
+			                final_solution.begin(),
+			                [&](auto& var){ return var.get_value(); } );
+		}
+
 	public:
 		/*!
 		 * Unique constructor of ghost::Solver
@@ -163,7 +446,15 @@ namespace ghost
 			  _search_iterations( 0 ),
 			  _local_minimum( 0 ),
 			  _plateau_moves( 0 ),
-			  _plateau_local_minimum( 0 )
+			  _plateau_local_minimum( 0 ),
+			  _compound_moves( 0 ),
+			  _interrupted_iterations( 0 ),
+			  _worst_deadline_overshoot( 0.0 ),
+			  _filtered_values( 0 ),
+			  _number_coarse_levels( 0 ),
+			  _enumerated_assignments( 0 ),
+			  _search_space_exhausted( false ),
+			  _intensification_improvements( 0 )
 		{	}
 
 		/*!
@@ -195,8 +486,12 @@ namespace ghost
 		 * being the closest from a solution) and writes the best candidate's values into the 
 		 * final_solution vector.
 		 *
-		 * For optimization problems modeled with an COP or EFOP, the solver will always continue 
-		 * running until reaching the timeout. If a solution is found, it outputs 'true' and writes
+		 * For optimization problems modeled with an COP or EFOP, the solver will continue running
+		 * until reaching the timeout, unless the options target_cost, stagnation_iterations or
+		 * stagnation_percent_budget are set: then the search stops as soon as a solution reaches the
+		 * target cost, or when the best solution is not improved for too long. In parallel runs,
+		 * all threads stop as soon as one of them reaches the target cost.
+		 * If a solution is found, it outputs 'true' and writes
 		 * into the final_cost variable the cost of the best solution optimizating the given objective
 		 * function. It also writes the values of the solution into the final_solution vector.\n
 		 * If no solutions are found, the solver outputs 'false' and adopt the same behavior as not
@@ -226,7 +521,6 @@ namespace ghost
 		{
 			std::chrono::time_point<std::chrono::steady_clock> start_wall_clock( std::chrono::steady_clock::now() );
 			std::chrono::time_point<std::chrono::steady_clock> start_search;
-			std::chrono::time_point<std::chrono::steady_clock> start_postprocess;
 			std::chrono::duration<double,std::micro> elapsed_time( 0 );
 			std::chrono::duration<double,std::micro> timer_postprocess( 0 );
 
@@ -237,34 +531,34 @@ namespace ghost
 			_model_builder.declare_variables();
 			_number_variables = _model_builder.get_number_variables();
 
-			_options = options;
-
-			if( _options.tabu_time_local_min < 0 )
-				_options.tabu_time_local_min = std::max( std::min( 5, static_cast<int>( _number_variables ) - 1 ), static_cast<int>( std::ceil( _number_variables / 5 ) ) ) + 1;
-			  //_options.tabu_time_local_min = std::max( 2, _tabu_threshold ) );
-
-			if( _options.tabu_time_selected < 0 )
-				_options.tabu_time_selected = 0;
+			set_options( options );
+			GHOST_PROBE2( solve_start, _number_variables, static_cast<long long>( timeout ) );
 
-			if( _options.percent_chance_escape_plateau < 0 || _options.percent_chance_escape_plateau > 100 )
-				_options.percent_chance_escape_plateau = 10;
-
-			if( _options.reset_threshold < 0 )
-				_options.reset_threshold = _options.tabu_time_local_min;
-// 			_options.reset_threshold = static_cast<int>( std::ceil( 1.5 * _options.reset_threshold ) );
-//		  _options.reset_threshold = 2 * static_cast<int>( std::ceil( std::sqrt( _number_variables ) ) );
+			double chrono_search;
+			double chrono_full_computation;
 
-			if( _options.restart_threshold < 0 )
-				_options.restart_threshold = _number_variables;
+			// Tiny search spaces are enumerated rather than searched, giving provably optimal results.
+			long long search_space_size = algorithms::ExhaustiveSearch::search_space_size( _model_builder.variables, _model_builder.permutation_problem, _options.exhaustive_search_threshold );
+			bool is_exhaustive = search_space_size > 0 && search_space_size <= _options.exhaustive_search_threshold;
+			_enumerated_assignments = 0;
+			_search_space_exhausted = false;
 
-			if( _options.number_variables_to_reset < 0 )
-				_options.number_variables_to_reset = std::max( 2, static_cast<int>( std::ceil( _number_variables * 0.1 ) ) ); // 10%
+			// In multilevel mode, coarse models are solved first to get the starting point of search units,
+			// which get the rest of the time budget.
+			double search_timeout = timeout;
+			std::vector<int> starting_point;
+			Options unit_options( _options );
 
-			if( _options.number_start_samplings < 0 )
-				_options.number_start_samplings = 10;
+			if( _options.multilevel && !is_exhaustive && !_options.custom_starting_point && !_options.resume_search )
+			{
+				std::chrono::time_point<std::chrono::steady_clock> start_multilevel( std::chrono::steady_clock::now() );
+				starting_point = solve_coarse_levels( options, timeout * _options.multilevel_percent_budget / 100 );
+				elapsed_time = std::chrono::steady_clock::now() - start_multilevel;
+				search_timeout = std::max( 0.0, timeout - elapsed_time.count() );
 
-			double chrono_search;
-			double chrono_full_computation;
+				if( !starting_point.empty() )
+					unit_options.custom_starting_point = true;
+			}
 
 			// In case final_solution is not a vector of the correct size,
 			// ie, equals to the number of variables.
@@ -273,6 +567,12 @@ namespace ghost
 			bool is_sequential;
 			bool is_optimization;
 
+			// Best solutions of search units, with their optimization cost, for the final intensification phase.
+			// Search units leave intensification_timeout microseconds of their time budget to this phase.
+			std::vector<std::pair<double,std::vector<int>>> unit_solutions;
+			double intensification_timeout = 0.0;
+			_intensification_improvements = 0;
+
 #if defined GHOST_DEBUG || defined GHOST_TRACE || defined GHOST_BENCH
 			// this is to make proper benchmarks/debugging with 1 thread.
 			is_sequential = !_options.parallel_runs;
@@ -280,36 +580,38 @@ namespace ghost
 			is_sequential = ( !_options.parallel_runs || _options.number_threads == 1 );
 #endif
 
+			if( is_exhaustive )
+			{
+				start_search = std::chrono::steady_clock::now();
+				solution_found = solve_exhaustively( search_space_size, search_timeout );
+				is_optimization = _model.objective->is_optimization();
+				elapsed_time = std::chrono::steady_clock::now() - start_search;
+				chrono_search = elapsed_time.count();
+			}
 			// sequential runs
-			if( is_sequential )
+			else if( is_sequential )
 			{
-				SearchUnit search_unit( _model_builder.build_model(),
-				                        _options );
+				SearchUnit search_unit( build_unit_model( starting_point ),
+				                        unit_options );
 
 				is_optimization = search_unit.data.is_optimization;
+				if( is_optimization )
+					intensification_timeout = search_timeout * _options.intensification_percent_budget / 100;
 				std::future<bool> unit_future = search_unit.solution_found.get_future();
 
 				start_search = std::chrono::steady_clock::now();
-				search_unit.search( timeout );
+				search_unit.search( search_timeout - intensification_timeout );
 				elapsed_time = std::chrono::steady_clock::now() - start_search;
 				chrono_search = elapsed_time.count();
 
 				solution_found = unit_future.get();
 				_best_sat_error = search_unit.data.best_sat_error;
 				_best_opt_cost = search_unit.data.best_opt_cost;
-				_restarts = search_unit.data.restarts;
-				_resets = search_unit.data.resets;
-				_local_moves = search_unit.data.local_moves;
-				_search_iterations = search_unit.data.search_iterations;
-				_local_minimum = search_unit.data.local_minimum;
-				_plateau_moves = search_unit.data.plateau_moves;
-				_plateau_local_minimum = search_unit.data.plateau_local_minimum;
-
-				_variable_heuristic = search_unit.variable_heuristic->get_name();
-				_variable_candidates_heuristic = search_unit.variable_candidates_heuristic->get_name();
-				_value_heuristic = search_unit.value_heuristic->get_name();
-				_error_projection_heuristic = search_unit.error_projection_heuristic->get_name();
-				
+				get_unit_statistics( search_unit );
+
+				if( solution_found )
+					unit_solutions.emplace_back( search_unit.data.best_opt_cost, search_unit.best() );
+
 				_model = std::move( search_unit.transfer_model() );
 			}
 			else // call threads
@@ -321,11 +623,13 @@ namespace ghost
 				for( int i = 0 ; i < _options.number_threads; ++i )
 				{
 					// Instantiate one model per thread
-					units.emplace_back( _model_builder.build_model(),
-					                    _options );
+					units.emplace_back( build_unit_model( starting_point ),
+					                    unit_options );
 				}
 
 				is_optimization = units[0].data.is_optimization;
+				if( is_optimization )
+					intensification_timeout = search_timeout * _options.intensification_percent_budget / 100;
 
 				std::vector<std::future<bool>> units_future;
 				std::vector<bool> units_terminated( _options.number_threads, false );
@@ -334,7 +638,7 @@ namespace ghost
 
 				for( int i = 0 ; i < _options.number_threads; ++i )
 				{
-					unit_threads.emplace_back( &SearchUnit::search, &units.at(i), timeout );
+					unit_threads.emplace_back( &SearchUnit::search, &units.at(i), search_timeout - intensification_timeout );
 					units.at( i ).get_thread_id( unit_threads.at( i ).get_id() );
 					units_future.emplace_back( units.at( i ).solution_found.get_future() );
 				}
@@ -363,6 +667,13 @@ namespace ghost
 										_best_opt_cost = units.at( thread_number ).data.best_opt_cost;
 										winning_thread = thread_number;
 									}
+
+									// No need to wait for other threads if the target cost is reached
+									if( units.at( thread_number ).target_reached() )
+									{
+										end_of_computation = true;
+										break;
+									}
 								}
 
 								if( number_timeouts >= _options.number_threads )
@@ -423,18 +734,7 @@ namespace ghost
 					_best_sat_error = units.at( winning_thread ).data.best_sat_error;
 					_best_opt_cost = units.at( winning_thread ).data.best_opt_cost;
 
-					_restarts = units.at( winning_thread ).data.restarts;
-					_resets = units.at( winning_thread ).data.resets;
-					_local_moves = units.at( winning_thread ).data.local_moves;
-					_search_iterations = units.at( winning_thread ).data.search_iterations;
-					_local_minimum = units.at( winning_thread ).data.local_minimum;
-					_plateau_moves = units.at( winning_thread ).data.plateau_moves;
-					_plateau_local_minimum = units.at( winning_thread ).data.plateau_local_minimum;
-
-					_variable_heuristic = units.at( winning_thread ).variable_heuristic->get_name();
-					_variable_candidates_heuristic = units.at( winning_thread ).variable_candidates_heuristic->get_name();
-					_value_heuristic = units.at( winning_thread ).value_heuristic->get_name();
-					_error_projection_heuristic = units.at( winning_thread ).error_projection_heuristic->get_name();
+					get_unit_statistics( units.at( winning_thread ) );
 
 					_model = std::move( units.at( winning_thread ).transfer_model() );
 				}
@@ -459,18 +759,7 @@ namespace ghost
 							}
 					}
 
-					_restarts = units.at( best_non_solution ).data.restarts;
-					_resets = units.at( best_non_solution ).data.resets;
-					_local_moves = units.at( best_non_solution ).data.local_moves;
-					_search_iterations = units.at( best_non_solution ).data.search_iterations;
-					_local_minimum = units.at( best_non_solution ).data.local_minimum;
-					_plateau_moves = units.at( best_non_solution ).data.plateau_moves;
-					_plateau_local_minimum = units.at( best_non_solution ).data.plateau_local_minimum;
-
-					_variable_heuristic = units.at( best_non_solution ).variable_heuristic->get_name();
-					_variable_candidates_heuristic = units.at( best_non_solution ).variable_candidates_heuristic->get_name();
-					_value_heuristic = units.at( best_non_solution ).value_heuristic->get_name();
-					_error_projection_heuristic = units.at( best_non_solution ).error_projection_heuristic->get_name();
+					get_unit_statistics( units.at( best_non_solution ) );
 					
 					_model = std::move( units.at( best_non_solution ).transfer_model() );
 				}
@@ -482,37 +771,22 @@ namespace ghost
 #endif
 					thread.join();
 				}
-			}
 
-			if( solution_found && is_optimization )
-			{
-				_cost_before_postprocess = _best_opt_cost;
-
-				start_postprocess = std::chrono::steady_clock::now();
-				_best_opt_cost = _model.objective->postprocess( _best_opt_cost );
-				timer_postprocess = std::chrono::steady_clock::now() - start_postprocess;
+				for( auto& unit : units )
+					if( unit.data.best_sat_error == 0.0 )
+						unit_solutions.emplace_back( unit.data.best_opt_cost, unit.best() );
 			}
 
-			if( is_optimization )
-			{
-				if( _best_opt_cost < 0 )
-				{
-					_best_opt_cost = -_best_opt_cost;
-					_cost_before_postprocess = -_cost_before_postprocess;
-				}
-
-				final_cost = _best_opt_cost;
-			}
-			else
-				final_cost = _best_sat_error;
+			// No need to intensify the search if the target cost is reached
+			if( solution_found && is_optimization && intensification_timeout > 0.0
+			    && !( _best_opt_cost <= ( _model.objective->is_maximization() ? -_options.target_cost : _options.target_cost ) ) )
+				intensify( unit_solutions, start_wall_clock + std::chrono::duration_cast<std::chrono::steady_clock::duration>( std::chrono::duration<double,std::micro>( timeout ) ) );
 
-			std::transform( _model.variables.begin(),
-			                _model.variables.end(),
-			                final_solution.begin(),
-			                [&](auto& var){ return var.get_value(); } );
+			write_final_values( final_cost, final_solution, solution_found, is_optimization, timer_postprocess );
 
 			elapsed_time = std::chrono::steady_clock::now() - start_wall_clock;
 			chrono_full_computation = elapsed_time.count();
+			GHOST_PROBE2( solve_end, solution_found, static_cast<long long>( chrono_full_computation ) );
 
 #if defined GHOST_DEBUG || defined GHOST_TRACE || defined GHOST_BENCH
 			std::cout << "@@@@@@@@@@@@" << "\n"
@@ -525,6 +799,8 @@ namespace ghost
 			          << "Parallel search: " << std::boolalpha << _options.parallel_runs << "\n"
 			          << "Number of threads (not used if no parallel search): " << _options.number_threads << "\n"
 			          << "Number of variable assignments samplings at start (if custom start and resume are set to false): " << _options.number_start_samplings << "\n"
+			          << "Target cost (NaN if none): " << _options.target_cost << "\n"
+			          << "Stop after " << _options.stagnation_iterations << " search iterations or " << _options.stagnation_percent_budget << "% of the time budget without improvements (-1 if disabled)\n"
 			          << "Variables of local minimum are frozen for: " << _options.tabu_time_local_min << " local moves\n"
 			          << "Selected variables are frozen for: " << _options.tabu_time_selected << " local moves\n"
 			          << "Percentage of chance to espace a plateau rather than exploring it: " << _options.percent_chance_escape_plateau << "%\n"
@@ -557,10 +833,16 @@ namespace ghost
 			          << "Wall-clock time (full call): " << chrono_full_computation << "us (= " << chrono_full_computation/1000 << "ms, " << chrono_full_computation/1000000 << "s)\n"
 			          << "Satisfaction error: " << _best_sat_error << "\n"
 			          << "Number of search iterations: " << _search_iterations << "\n"
-			          << "Number of local moves: " << _local_moves << " (including on plateau: " << _plateau_moves << ")\n"
+			          << "Number of local moves: " << _local_moves << " (including on plateau: " << _plateau_moves << ", from other neighborhoods: " << _compound_moves << ")\n"
 			          << "Number of local minimum: " << _local_minimum << " (including on plateau: " << _plateau_local_minimum << ")\n"
 			          << "Number of resets: " << _resets << "\n"
-			          << "Number of restarts: " << _restarts << "\n";
+			          << "Number of restarts: " << _restarts << "\n"
+			          << "Number of search iterations interrupted by the deadline: " << _interrupted_iterations << "\n"
+			          << "Worst deadline overshoot: " << _worst_deadline_overshoot << "us\n"
+			          << "Number of candidate values filtered out: " << _filtered_values << "\n"
+			          << "Number of coarse levels (multilevel mode): " << _number_coarse_levels << "\n"
+			          << "Number of assignments enumerated (exhaustive search): " << _enumerated_assignments << " (whole search space: " << std::boolalpha << _search_space_exhausted << ")\n"
+			          << "Number of moves of the final intensification phase: " << _intensification_improvements << "\n";
 
 			if( _options.parallel_runs )
 				std::cout << "Total number of search iterations: " << _search_iterations_total << "\n"
@@ -650,6 +932,333 @@ namespace ghost
 			return solve( final_cost, final_solution, timeout, options );
 		}
 
+		/*!
+		 * Method to start a search that will be run step by step, through Solver::step calls,
+		 * rather than in one go with Solver::solve. This is useful to interleave the search with
+		 * other tasks on the same thread, for instance to give the solver a time slice at each
+		 * frame of a game loop.
+		 *
+		 * Solver::begin builds the model and initializes the search (including starting samplings),
+		 * but does not start searching. A step-by-step search is always sequential: the parallel_runs
+		 * option is ignored. Calling Solver::begin again discards the current step-by-step search
+		 * and starts a new one.
+		 *
+		 * \param options a reference to an Options object containing options such as a solution
+		 * printer, if the solver must start with a custom variable assignment, parameter tuning, etc.
+		 * \sa step, best, end
+		 */
+		void begin( Options& options )
+		{
+			_model_builder.declare_variables();
+			_number_variables = _model_builder.get_number_variables();
+
+			set_options( options );
+			_stepping_start = std::chrono::steady_clock::now();
+			GHOST_PROBE2( solve_start, _number_variables, 0LL );
+
+			_stepping_unit = std::make_unique<SearchUnit>( _model_builder.build_model(), _options );
+			_stepping_unit->begin();
+		}
+
+		/*!
+		 * Call Solver::begin with default options.
+		 */
+		void begin()
+		{
+			Options options;
+			begin( options );
+		}
+
+		/*!
+		 * Method to resume the search started by Solver::begin, for at most max_iterations search
+		 * iterations. All search states are kept from one call to another: nothing is re-initialized.
+		 *
+		 * \param max_iterations the maximal number of search iterations to run.
+		 * \return True if and only if the search must continue, i.e., if Solver::step can be called
+		 * again. It returns false when a solution has been found for a satisfaction problem, or if
+		 * no search has been started by Solver::begin.
+		 */
+		bool step( int max_iterations )
+		{
+			if( !_stepping_unit )
+				return false;
+
+			return _stepping_unit->step( max_iterations );
+		}
+
+		/*!
+		 * Method to resume the search started by Solver::begin until the given deadline is reached.
+		 * All search states are kept from one call to another: nothing is re-initialized.
+		 *
+		 * The deadline is also checked within search iterations, between two evaluations of
+		 * neighbors: an iteration reaching the deadline is abandoned without making any move, and
+		 * the next call starts a new one. The call thus returns after the deadline, with a
+		 * delay typically bounded by the evaluation of a few neighbors rather than a whole search
+		 * iteration (see Solver::get_worst_deadline_overshoot).
+		 *
+		 * \param deadline a time point of the std::chrono::steady_clock after which the solver
+		 * must yield.
+		 * \return True if and only if the search must continue, i.e., if Solver::step can be called
+		 * again. It returns false when a solution has been found for a satisfaction problem, or if
+		 * no search has been started by Solver::begin.
+		 */
+		bool step( std::chrono::time_point<std::chrono::steady_clock> deadline )
+		{
+			if( !_stepping_unit )
+				return false;
+
+			return _stepping_unit->step( deadline );
+		}
+
+		/*!
+		 * Call Solver::step with a deadline set to now plus the given time budget.
+		 *
+		 * \param budget a std::chrono::microseconds for the time slice given to the solver.
+		 * \return True if and only if the search must continue.
+		 */
+		bool step( std::chrono::microseconds budget )
+		{
+			return step( std::chrono::steady_clock::now() + budget );
+		}
+
+		/*!
+		 * Method to get the best candidate or solution found so far by the search started by
+		 * Solver::begin, without stopping it.
+		 *
+		 * Unlike Solver::end, the optimization cost is not post-processed.
+		 *
+		 * \param best_cost a reference to a double to get the error of the best candidate if no
+		 * solutions have been found so far, or the objective function value of the best solution
+		 * for optimization problems (0 for satisfaction problems).
+		 * \param best_solution a reference to a vector of integers, to get values of the best
+		 * candidate or solution found so far.
+		 * \return True if and only if a solution has been found so far.
+		 */
+		bool best( double& best_cost, std::vector<int>& best_solution ) const
+		{
+			if( !_stepping_unit )
+				return false;
+
+			best_solution = _stepping_unit->best();
+
+			if( _stepping_unit->data.is_optimization && _stepping_unit->data.best_sat_error == 0.0 )
+			{
+				best_cost = _stepping_unit->data.best_opt_cost;
+				if( _stepping_unit->model.objective->is_maximization() )
+					best_cost = -best_cost;
+			}
+			else
+				best_cost = _stepping_unit->data.best_sat_error;
+
+			return _stepping_unit->data.best_sat_error == 0.0;
+		}
+
+		/*!
+		 * Method to close the search started by Solver::begin. It outputs the same results as
+		 * Solver::solve, including the optimization cost post-processing.
+		 *
+		 * \param final_cost a reference to a double to get the error of the best candidate or
+		 * solution for satisfaction problems, or the objective function value of the best solution
+		 * for optimization problems (or the cost of the best candidate if no solution has been
+		 * found). For satisfaction problems, a cost of zero means a solution has been found.
+		 * \param final_solution a reference to a vector of integers, to get values of the best
+		 *  candidate or solution found.
+		 * \return True if and only if a solution has been found.
+		 */
+		bool end( double& final_cost, std::vector<int>& final_solution )
+		{
+			if( !_stepping_unit )
+				return false;
+
+			std::future<bool> unit_future = _stepping_unit->solution_found.get_future();
+			_stepping_unit->end();
+
+			bool solution_found = unit_future.get();
+			GHOST_PROBE2( solve_end, solution_found, static_cast<long long>( std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - _stepping_start ).count() ) );
+			bool is_optimization = _stepping_unit->data.is_optimization;
+			_best_sat_error = _stepping_unit->data.best_sat_error;
+			_best_opt_cost = _stepping_unit->data.best_opt_cost;
+			get_unit_statistics( *_stepping_unit );
+
+			_model = std::move( _stepping_unit->transfer_model() );
+			_stepping_unit.reset();
+
+			std::chrono::duration<double,std::micro> timer_postprocess( 0 );
+			write_final_values( final_cost, final_solution, solution_found, is_optimization, timer_postprocess );
+
+			return solution_found;
+		}
+
+		/*!
+		 * Method returning the memory taken by the solver, broken down by data structures: the model
+		 * kept by the solver after a search, and one search unit. Solver::solve builds one search
+		 * unit per thread, each with its own model.
+		 *
+		 * The search unit is the one of the current step-by-step search if Solver::begin has been
+		 * called, or a search unit built like Solver::solve does otherwise.
+		 *
+		 * \return A MemoryUsage object, in bytes.
+		 * \sa MemoryUsage
+		 */
+		MemoryUsage memory_usage()
+		{
+			MemoryUsage usage;
+			usage.add( "solver model", _model.memory_usage() );
+
+			if( _stepping_unit )
+				usage.add( "search unit", _stepping_unit->memory_usage() );
+			else
+			{
+				Model model = _model_builder.build_model();
+				int number_variables = static_cast<int>( model.variables.size() );
+				SearchUnit search_unit( std::move( model ), complete_options( _options, number_variables ) );
+				usage.add( "search unit", search_unit.memory_usage() );
+			}
+
+			return usage;
+		}
+
+		/*!
+		 * Inline method returning the worst delay, in microseconds, between a deadline and the moment the
+		 * search yielded during the last Solver::solve call, or the last step-by-step search closed by
+		 * Solver::end. Deadline and stop requests are checked within search iterations, so this delay
+		 * is typically bounded by the evaluation of a few neighbors rather than a whole search iteration.
+		 */
+		inline double get_worst_deadline_overshoot() const { return _worst_deadline_overshoot; }
+
 		inline std::vector<Variable> get_variables() { return _model.variables; }
 	};
+
+#if defined __cpp_impl_coroutine && __has_include( <coroutine> )
+	/*!
+	 * SearchTask is the coroutine type returned by ghost::cooperative_search, to run a
+	 * step-by-step search as a cooperative task. It is only available with compilers supporting
+	 * C++20 coroutines.
+	 *
+	 * Each call to SearchTask::resume runs the search until the given deadline, then gives the
+	 * control back to the caller, typically a frame scheduler.
+	 *
+	 * \sa cooperative_search
+	 */
+	class SearchTask final
+	{
+	public:
+		struct promise_type
+		{
+			std::chrono::time_point<std::chrono::steady_clock> deadline;
+			std::exception_ptr exception;
+
+			SearchTask get_return_object() { return SearchTask( std::coroutine_handle<promise_type>::from_promise( *this ) ); }
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			std::suspend_always final_suspend() noexcept { return {}; }
+			void return_void() { }
+			void unhandled_exception() { exception = std::current_exception(); }
+		};
+
+		// Awaitable giving the deadline of the current time slice to the coroutine, without suspending it.
+		struct slice_deadline
+		{
+			std::chrono::time_point<std::chrono::steady_clock> deadline;
+
+			bool await_ready() const noexcept { return false; }
+			bool await_suspend( std::coroutine_handle<promise_type> handle ) noexcept
+			{
+				deadline = handle.promise().deadline;
+				return false;
+			}
+			std::chrono::time_point<std::chrono::steady_clock> await_resume() const noexcept { return deadline; }
+		};
+
+	private:
+		std::coroutine_handle<promise_type> _handle;
+
+		explicit SearchTask( std::coroutine_handle<promise_type> handle )
+			: _handle( handle )
+		{ }
+
+	public:
+		SearchTask( const SearchTask& ) = delete;
+		SearchTask& operator=( const SearchTask& ) = delete;
+
+		SearchTask( SearchTask&& other ) noexcept
+			: _handle( std::exchange( other._handle, nullptr ) )
+		{ }
+
+		SearchTask& operator=( SearchTask&& other ) noexcept
+		{
+			if( this != &other )
+			{
+				if( _handle )
+					_handle.destroy();
+				_handle = std::exchange( other._handle, nullptr );
+			}
+			return *this;
+		}
+
+		~SearchTask()
+		{
+			if( _handle )
+				_handle.destroy();
+		}
+
+		/*!
+		 * Run the search until the given deadline.
+		 *
+		 * Exceptions thrown during the search are rethrown by this method.
+		 *
+		 * \param deadline a time point of the std::chrono::steady_clock after which the search must yield.
+		 * \return True if and only if the search must continue, i.e., if SearchTask::resume can be called again.
+		 */
+		bool resume( std::chrono::time_point<std::chrono::steady_clock> deadline )
+		{
+			if( done() )
+				return false;
+
+			_handle.promise().deadline = deadline;
+			_handle.resume();
+
+			if( _handle.promise().exception )
+				std::rethrow_exception( std::exchange( _handle.promise().exception, nullptr ) );
+
+			return !done();
+		}
+
+		/*!
+		 * Call SearchTask::resume with a deadline set to now plus the given time budget.
+		 */
+		bool resume( std::chrono::microseconds budget )
+		{
+			return resume( std::chrono::steady_clock::now() + budget );
+		}
+
+		//! Inline method returning true if and only if the search is over.
+		inline bool done() const { return !_handle || _handle.done(); }
+	};
+
+	/*!
+	 * Coroutine running a step-by-step search of the given solver, one time slice per
+	 * SearchTask::resume call. The search starts with the first call to SearchTask::resume, and
+	 * is over when the task is done. Then, results are obtained by calling Solver::end, while
+	 * Solver::best can be called between two time slices. The solver must outlive the task.
+	 *
+	 * \param solver a reference to the Solver object running the search.
+	 * \param options an Options object, passed to Solver::begin.
+	 * \return A SearchTask to be resumed by the caller.
+	 * \sa SearchTask, Solver::begin
+	 */
+	template<typename ModelBuilderType>
+	SearchTask cooperative_search( Solver<ModelBuilderType>& solver, Options options )
+	{
+		solver.begin( options );
+
+		while( true )
+		{
+			std::chrono::time_point<std::chrono::steady_clock> deadline = co_await SearchTask::slice_deadline{};
+			if( !solver.step( deadline ) )
+				co_return;
+
+			co_await std::suspend_always{};
+		}
+	}
+#endif
 }
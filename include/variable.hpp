@@ -57,6 +57,7 @@ namespace ghost
 	{
 		friend class SearchUnit;
 		friend class ModelBuilder;
+		friend struct Model;
 
 		std::vector<int> _domain; // The domain, i.e., the vector of values the variable can take.
 		int _id; // Unique ID integer
@@ -154,6 +155,17 @@ namespace ghost
 		 */
 		inline std::vector<int> get_full_domain() const { return _domain; }
 
+		/*!
+		 * Inline method to know if a value belongs to the domain.
+		 *
+		 * \param value the value to look for.
+		 * \return True if and only if the value is in the domain.
+		 */
+		inline bool is_in_domain( int value ) const
+		{
+			return value >= _min_value && value <= _max_value && std::find( _domain.cbegin(), _domain.cend(), value ) != _domain.cend();
+		}
+
 		/*!
 		 * Method returning the range of values
 		 * [current_value - range/2 [mod domain_size], current_value + range/2 [mod domain_size]]
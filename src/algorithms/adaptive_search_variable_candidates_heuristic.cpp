@@ -34,27 +34,35 @@ using ghost::algorithms::AdaptiveSearchVariableCandidatesHeuristic;
 AdaptiveSearchVariableCandidatesHeuristic::AdaptiveSearchVariableCandidatesHeuristic()
 	: VariableCandidatesHeuristic( "Adaptive Search" )
 { }
+
+AdaptiveSearchVariableCandidatesHeuristic::AdaptiveSearchVariableCandidatesHeuristic( std::string&& name )
+	: VariableCandidatesHeuristic( std::move( name ) )
+{ }
+
+bool AdaptiveSearchVariableCandidatesHeuristic::is_eligible( const SearchUnitData& data, int variable_id ) const
+{
+	return true;
+}
 		
-std::vector<double> AdaptiveSearchVariableCandidatesHeuristic::compute_variable_candidates( const SearchUnitData& data ) const
+void AdaptiveSearchVariableCandidatesHeuristic::compute_variable_candidates( const SearchUnitData& data, VariableCandidates& candidates ) const
 {
-	std::vector<double> worst_variables_list;
+	candidates.clear( data.number_variables );
 	double worst_variable_cost = -1;
 
 	for( int variable_id = 0; variable_id < data.number_variables; ++variable_id )
 		if( worst_variable_cost <= data.error_variables[ variable_id ]
 		    && data.tabu_list[ variable_id ] <= data.local_moves
+		    && is_eligible( data, variable_id )
 		    && ( !data.matrix_var_ctr.at( variable_id ).empty() || ( data.is_optimization && data.current_sat_error == 0 ) ) )
 		{
 			if( worst_variable_cost < data.error_variables[ variable_id ] )
 			{
-				worst_variables_list.clear();
-				worst_variables_list.push_back( variable_id );
+				candidates.clear( data.number_variables );
+				candidates.add( variable_id );
 				worst_variable_cost = data.error_variables[ variable_id ];
 			}
 			else
 				if( worst_variable_cost == data.error_variables[ variable_id ] )
-					worst_variables_list.push_back( variable_id );
+					candidates.add( variable_id );
 		}
-		
-	return worst_variables_list;
 }
@@ -36,13 +36,14 @@ AntidoteSearchVariableCandidatesHeuristic::AntidoteSearchVariableCandidatesHeuri
 	: VariableCandidatesHeuristic( "Antidote Search" )
 { }
 
-std::vector<double> AntidoteSearchVariableCandidatesHeuristic::compute_variable_candidates( const SearchUnitData& data ) const
+void AntidoteSearchVariableCandidatesHeuristic::compute_variable_candidates( const SearchUnitData& data, VariableCandidates& candidates ) const
 {
-	auto error_variables = data.error_variables;
+	candidates.clear( data.number_variables, true );
 		
 	for( int variable_id = 0; variable_id < data.number_variables; ++variable_id )
-		if( data.tabu_list[ variable_id ] > data.local_moves )
-			error_variables[ variable_id ] = 0.0;
-
-	return error_variables;
+	{
+		candidates.add( variable_id );
+		if( data.tabu_list[ variable_id ] <= data.local_moves )
+			candidates.set_weight( variable_id, data.error_variables[ variable_id ] );
+	}
 }
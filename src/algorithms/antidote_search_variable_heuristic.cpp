@@ -36,8 +36,8 @@ AntidoteSearchVariableHeuristic::AntidoteSearchVariableHeuristic()
 	: VariableHeuristic( "Antidote Search" )
 { }
 		
-int AntidoteSearchVariableHeuristic::select_variable_candidate( const std::vector<double>& candidates, const SearchUnitData& data, randutils::mt19937_rng& rng ) const
+int AntidoteSearchVariableHeuristic::select_variable_candidate( const VariableCandidates& candidates, const SearchUnitData& data, randutils::mt19937_rng& rng ) const
 {
 	// WARNING: must remove variables which are in any constraints
-	return rng.variate<int, std::discrete_distribution>( candidates.begin(), candidates.end() );
+	return rng.variate<int, std::discrete_distribution>( candidates.get_weights().begin(), candidates.get_weights().end() );
 }
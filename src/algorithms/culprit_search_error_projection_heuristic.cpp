@@ -47,6 +47,11 @@ void CulpritSearchErrorProjection::initialize_data_structures()
 	_error_variables_by_constraints = std::vector<std::vector<double>>( number_constraints, std::vector<double>( number_variables, 0. ) );
 }
 
+std::size_t CulpritSearchErrorProjection::memory_usage() const
+{
+	return MemoryUsage::heap_bytes( _error_variables_by_constraints );
+}
+
 void CulpritSearchErrorProjection::compute_variable_errors_on_constraint( const std::vector<Variable>& variables,
 	                                                                        const std::vector<std::vector<int>>& matrix_var_ctr,
 	                                                                        std::shared_ptr<Constraint> constraint )
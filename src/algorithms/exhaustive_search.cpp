@@ -0,0 +1,223 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <cmath>
+
+#include "algorithms/exhaustive_search.hpp"
+
+using ghost::algorithms::ExhaustiveSearch;
+using ghost::Model;
+using ghost::Variable;
+
+ExhaustiveSearch::ExhaustiveSearch( Model&& model, double target_cost )
+	: _model( std::move( model ) ),
+	  _variable_constraints( _model.variables.size() ),
+	  _digits( _model.variables.size() ),
+	  _changed_constraints( _model.constraints.size(), false ),
+	  _is_optimization( _model.objective->is_optimization() ),
+	  _target_cost( _model.objective->is_maximization() ? -target_cost : target_cost ),
+	  _best_sat_error( std::numeric_limits<double>::max() ),
+	  _best_opt_cost( std::numeric_limits<double>::max() ),
+	  _enumerated_assignments( 0 ),
+	  _exhausted( false )
+{
+	for( int constraint_id = 0 ; constraint_id < static_cast<int>( _model.constraints.size() ) ; ++constraint_id )
+		for( int variable_id : _model.constraints[ constraint_id ]->_variables_index )
+			_variable_constraints[ variable_id ].push_back( constraint_id );
+
+	if( _model.permutation_problem )
+	{
+		for( const auto& variable : _model.variables )
+			_permutation_values.push_back( variable.get_value() );
+		std::sort( _permutation_values.begin(), _permutation_values.end() );
+	}
+	else
+		for( const auto& variable : _model.variables )
+			_domains.push_back( variable.get_full_domain() );
+}
+
+long long ExhaustiveSearch::search_space_size( const std::vector<Variable>& variables, bool permutation_problem, long long bound )
+{
+	long long size = 1;
+	for( int variable_id = 0 ; variable_id < static_cast<int>( variables.size() ) ; ++variable_id )
+	{
+		long long factor = permutation_problem ? variable_id + 1 : static_cast<long long>( variables[ variable_id ].get_domain_size() );
+		// Checked before multiplying, to avoid overflows
+		if( factor > 0 && size > bound / factor )
+			return bound + 1;
+		size *= factor;
+	}
+
+	return size;
+}
+
+void ExhaustiveSearch::set_rank( long long rank )
+{
+	int number_variables = static_cast<int>( _digits.size() );
+
+	if( _model.permutation_problem )
+	{
+		// Factorial number system: the i-th digit is the index of the i-th value among the values left
+		std::vector<int> factoradic( number_variables );
+		for( int base = 1 ; base <= number_variables ; ++base )
+		{
+			factoradic[ number_variables - base ] = static_cast<int>( rank % base );
+			rank /= base;
+		}
+
+		std::vector<int> left( number_variables );
+		std::iota( left.begin(), left.end(), 0 );
+		for( int variable_id = 0 ; variable_id < number_variables ; ++variable_id )
+		{
+			_digits[ variable_id ] = left[ factoradic[ variable_id ] ];
+			left.erase( left.begin() + factoradic[ variable_id ] );
+		}
+	}
+	else
+		for( int variable_id = number_variables - 1 ; variable_id >= 0 ; --variable_id )
+		{
+			long long radix = static_cast<long long>( _domains[ variable_id ].size() );
+			_digits[ variable_id ] = static_cast<int>( rank % radix );
+			rank /= radix;
+		}
+}
+
+void ExhaustiveSearch::next_rank()
+{
+	if( _model.permutation_problem )
+		std::next_permutation( _digits.begin(), _digits.end() );
+	else
+		for( int variable_id = static_cast<int>( _digits.size() ) - 1 ; variable_id >= 0 ; --variable_id )
+		{
+			if( ++_digits[ variable_id ] < static_cast<int>( _domains[ variable_id ].size() ) )
+				break;
+			_digits[ variable_id ] = 0;
+		}
+}
+
+void ExhaustiveSearch::assign_values()
+{
+	for( int variable_id = 0 ; variable_id < static_cast<int>( _digits.size() ) ; ++variable_id )
+	{
+		int value = _model.permutation_problem ? _permutation_values[ _digits[ variable_id ] ] : _domains[ variable_id ][ _digits[ variable_id ] ];
+		if( _model.variables[ variable_id ].get_value() != value )
+		{
+			_model.variables[ variable_id ].set_value( value );
+			_model.auxiliary_data->update( variable_id, value );
+			for( int constraint_id : _variable_constraints[ variable_id ] )
+				_changed_constraints[ constraint_id ] = true;
+		}
+	}
+
+	for( int constraint_id = 0 ; constraint_id < static_cast<int>( _model.constraints.size() ) ; ++constraint_id )
+		if( _changed_constraints[ constraint_id ] )
+		{
+			_model.constraints[ constraint_id ]->_current_error = _model.constraints[ constraint_id ]->error();
+			_changed_constraints[ constraint_id ] = false;
+		}
+}
+
+bool ExhaustiveSearch::evaluate()
+{
+	++_enumerated_assignments;
+
+	// Summed up again rather than updated, so that rounding errors do not hide solutions
+	double sat_error = 0.0;
+	for( const auto& constraint : _model.constraints )
+		sat_error += constraint->_current_error;
+
+	if( sat_error > 0.0 )
+	{
+		if( sat_error < _best_sat_error )
+		{
+			_best_sat_error = sat_error;
+			std::transform( _model.variables.begin(), _model.variables.end(), _best_values.begin(), [&](auto& var){ return var.get_value(); } );
+		}
+
+		return false;
+	}
+
+	double opt_cost = _is_optimization ? _model.objective->cost() : 0.0;
+	if( _best_sat_error > 0.0 || opt_cost < _best_opt_cost )
+	{
+		_best_sat_error = 0.0;
+		_best_opt_cost = opt_cost;
+		std::transform( _model.variables.begin(), _model.variables.end(), _best_values.begin(), [&](auto& var){ return var.get_value(); } );
+	}
+
+	return !_is_optimization || _best_opt_cost <= _target_cost;
+}
+
+void ExhaustiveSearch::search( long long first_rank,
+                               long long end_rank,
+                               std::chrono::time_point<std::chrono::steady_clock> deadline,
+                               std::atomic<bool>& stop )
+{
+	_best_values.resize( _model.variables.size() );
+
+	set_rank( first_rank );
+	for( int variable_id = 0 ; variable_id < static_cast<int>( _digits.size() ) ; ++variable_id )
+		_model.variables[ variable_id ].set_value( _model.permutation_problem ? _permutation_values[ _digits[ variable_id ] ] : _domains[ variable_id ][ _digits[ variable_id ] ] );
+	_model.auxiliary_data->update();
+
+	for( auto& constraint : _model.constraints )
+		constraint->_current_error = constraint->error();
+
+	for( long long rank = first_rank ; rank < end_rank ; ++rank )
+	{
+		if( ( rank - first_rank ) % 1024 == 1023 && ( stop.load( std::memory_order_relaxed ) || std::chrono::steady_clock::now() >= deadline ) )
+			return;
+
+		if( rank > first_rank )
+		{
+			next_rank();
+			assign_values();
+		}
+
+		if( evaluate() )
+		{
+			stop.store( true, std::memory_order_relaxed );
+			return;
+		}
+	}
+
+	_exhausted = true;
+}
+
+Model&& ExhaustiveSearch::transfer_model()
+{
+	if( _best_sat_error < std::numeric_limits<double>::max() )
+		for( int variable_id = 0 ; variable_id < static_cast<int>( _best_values.size() ) ; ++variable_id )
+			_model.variables[ variable_id ].set_value( _best_values[ variable_id ] );
+
+	return std::move( _model );
+}
@@ -0,0 +1,144 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include "algorithms/intensification.hpp"
+
+using ghost::algorithms::Intensification;
+using ghost::Model;
+
+Intensification::Intensification( Model&& model, const std::vector<int>& solution )
+	: _model( std::move( model ) ),
+	  _variable_constraints( _model.variables.size() ),
+	  _constraint_marks( _model.constraints.size(), -1 ),
+	  _evaluated_moves( 0 ),
+	  _improvements( 0 ),
+	  _local_optimum( false )
+{
+	for( int constraint_id = 0 ; constraint_id < static_cast<int>( _model.constraints.size() ) ; ++constraint_id )
+		for( int variable_id : _model.constraints[ constraint_id ]->_variables_index )
+			_variable_constraints[ variable_id ].push_back( constraint_id );
+
+	for( int variable_id = 0 ; variable_id < static_cast<int>( solution.size() ) ; ++variable_id )
+		_model.variables[ variable_id ].set_value( solution[ variable_id ] );
+	_model.auxiliary_data->update();
+
+	_opt_cost = _model.objective->cost();
+}
+
+void Intensification::assign( const std::vector<int>& variables, const std::vector<int>& values )
+{
+	for( int i = 0 ; i < static_cast<int>( variables.size() ) ; ++i )
+	{
+		_model.variables[ variables[ i ] ].set_value( values[ i ] );
+		_model.auxiliary_data->update( variables[ i ], values[ i ] );
+	}
+}
+
+bool Intensification::try_move( const std::vector<int>& variables, const std::vector<int>& values )
+{
+	std::vector<int> backup_values( variables.size() );
+	for( int i = 0 ; i < static_cast<int>( variables.size() ) ; ++i )
+		backup_values[ i ] = _model.variables[ variables[ i ] ].get_value();
+
+	_move_constraints.clear();
+	for( int variable_id : variables )
+		for( int constraint_id : _variable_constraints[ variable_id ] )
+			if( _constraint_marks[ constraint_id ] != _evaluated_moves )
+			{
+				_constraint_marks[ constraint_id ] = _evaluated_moves;
+				_move_constraints.push_back( constraint_id );
+			}
+	++_evaluated_moves;
+
+	assign( variables, values );
+
+	// Other constraints are satisfied: the move leads to a solution iff these constraints stay satisfied
+	bool is_solution = true;
+	for( int constraint_id : _move_constraints )
+		if( _model.constraints[ constraint_id ]->error() > 0.0 )
+		{
+			is_solution = false;
+			break;
+		}
+
+	if( is_solution )
+	{
+		double opt_cost = _model.objective->cost();
+		if( opt_cost < _opt_cost )
+		{
+			_opt_cost = opt_cost;
+			++_improvements;
+			return true;
+		}
+	}
+
+	assign( variables, backup_values );
+	return false;
+}
+
+void Intensification::search( std::chrono::time_point<std::chrono::steady_clock> deadline )
+{
+	int number_variables = static_cast<int>( _model.variables.size() );
+	bool improved = true;
+
+	while( improved )
+	{
+		improved = false;
+
+		// Changing the value of a variable breaks permutations
+		if( !_model.permutation_problem )
+			for( int variable_id = 0 ; variable_id < number_variables ; ++variable_id )
+				for( int value : _model.variables[ variable_id ].get_full_domain() )
+				{
+					if( value == _model.variables[ variable_id ].get_value() )
+						continue;
+
+					if( ( _evaluated_moves & 63 ) == 0 && std::chrono::steady_clock::now() >= deadline )
+						return;
+
+					improved = try_move( std::vector<int>{ variable_id }, std::vector<int>{ value } ) || improved;
+				}
+
+		for( int variable_id = 0 ; variable_id < number_variables ; ++variable_id )
+			for( int other_id = variable_id + 1 ; other_id < number_variables ; ++other_id )
+			{
+				int value = _model.variables[ variable_id ].get_value();
+				int other_value = _model.variables[ other_id ].get_value();
+				if( value == other_value || !_model.variables[ variable_id ].is_in_domain( other_value ) || !_model.variables[ other_id ].is_in_domain( value ) )
+					continue;
+
+				if( ( _evaluated_moves & 63 ) == 0 && std::chrono::steady_clock::now() >= deadline )
+					return;
+
+				improved = try_move( std::vector<int>{ variable_id, other_id }, std::vector<int>{ other_value, value } ) || improved;
+			}
+	}
+
+	_local_optimum = true;
+}
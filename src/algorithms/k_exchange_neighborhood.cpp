@@ -0,0 +1,87 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+
+#include "algorithms/k_exchange_neighborhood.hpp"
+
+using ghost::algorithms::KExchangeNeighborhood;
+using ghost::algorithms::Move;
+using ghost::SearchUnitData;
+using ghost::Model;
+
+KExchangeNeighborhood::KExchangeNeighborhood( int k, int number_moves )
+	: Neighborhood( "k-exchange" ),
+	  _k( std::max( 2, k ) ),
+	  _number_moves( number_moves )
+{ }
+
+std::vector<Move> KExchangeNeighborhood::get_moves( int variable_to_change,
+                                                    const SearchUnitData& data,
+                                                    const Model& model,
+                                                    randutils::mt19937_rng& rng ) const
+{
+	std::vector<Move> moves;
+	int k = std::min( _k, data.number_variables );
+	if( k < 2 )
+		return moves;
+
+	std::vector<int> other_variables;
+	other_variables.reserve( data.number_variables - 1 );
+	for( int variable_id = 0 ; variable_id < data.number_variables ; ++variable_id )
+		if( variable_id != variable_to_change )
+			other_variables.push_back( variable_id );
+
+	for( int move = 0 ; move < _number_moves ; ++move )
+	{
+		// Draw k-1 other variables with a partial Fisher-Yates shuffle
+		for( int i = 0 ; i < k - 1 ; ++i )
+			std::swap( other_variables[ i ], other_variables[ rng.uniform( i, static_cast<int>( other_variables.size() ) - 1 ) ] );
+
+		Move rotation;
+		rotation.variables.push_back( variable_to_change );
+		rotation.variables.insert( rotation.variables.end(), other_variables.begin(), other_variables.begin() + ( k - 1 ) );
+
+		bool is_valid = true;
+		bool changes_something = false;
+		for( int i = 0 ; i < k && is_valid ; ++i )
+		{
+			const auto& variable = model.variables[ rotation.variables[ i ] ];
+			int value = model.variables[ rotation.variables[ ( i + 1 ) % k ] ].get_value();
+			is_valid = variable.is_in_domain( value );
+			changes_something = changes_something || value != variable.get_value();
+			rotation.values.push_back( value );
+		}
+
+		if( is_valid && changes_something )
+			moves.push_back( std::move( rotation ) );
+	}
+
+	return moves;
+}
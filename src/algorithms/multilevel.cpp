@@ -0,0 +1,320 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <iterator>
+
+#include "algorithms/multilevel.hpp"
+#include "model_builder.hpp"
+
+using ghost::algorithms::ProjectedConstraint;
+using ghost::algorithms::ProjectedObjective;
+using ghost::algorithms::Multilevel;
+using ghost::Variable;
+using ghost::Constraint;
+using ghost::Objective;
+using ghost::Model;
+using ghost::NullObjective;
+
+namespace
+{
+	// Constraints with a larger scope do not tell which variables are strongly connected
+	constexpr int max_rated_scope = 32;
+
+	// ModelBuilder of a coarse model, whose elements are built beforehand
+	class CoarseModelBuilder : public ghost::ModelBuilder
+	{
+		std::vector<Variable> _coarse_variables;
+		std::vector<std::shared_ptr<Constraint>> _coarse_constraints;
+		std::shared_ptr<Objective> _coarse_objective;
+
+	public:
+		CoarseModelBuilder( std::vector<Variable>&& coarse_variables,
+		                    std::vector<std::shared_ptr<Constraint>>&& coarse_constraints,
+		                    const std::shared_ptr<Objective>& coarse_objective )
+			: ModelBuilder( false ),
+			  _coarse_variables( std::move( coarse_variables ) ),
+			  _coarse_constraints( std::move( coarse_constraints ) ),
+			  _coarse_objective( coarse_objective )
+		{ }
+
+		void declare_variables() override { variables = _coarse_variables; }
+		void declare_constraints() override { constraints = _coarse_constraints; }
+		void declare_objective() override { objective = _coarse_objective; }
+	};
+
+	// Return the sorted IDs of coarse variables merging the variables of a scope, and write in projection
+	// the position among them of the coarse variable merging each variable of the scope.
+	std::vector<int> coarse_scope( const std::vector<int>& variables_index,
+	                               const std::vector<int>& merged_into,
+	                               std::vector<int>& projection )
+	{
+		std::vector<int> coarse_variables_index( variables_index.size() );
+		std::transform( variables_index.begin(),
+		                variables_index.end(),
+		                coarse_variables_index.begin(),
+		                [&]( int variable_id ){ return merged_into[ variable_id ]; } );
+
+		std::vector<int> scope( coarse_variables_index );
+		std::sort( scope.begin(), scope.end() );
+		scope.erase( std::unique( scope.begin(), scope.end() ), scope.end() );
+
+		projection.resize( coarse_variables_index.size() );
+		std::transform( coarse_variables_index.begin(),
+		                coarse_variables_index.end(),
+		                projection.begin(),
+		                [&]( int coarse_id ){ return static_cast<int>( std::lower_bound( scope.begin(), scope.end(), coarse_id ) - scope.begin() ); } );
+
+		return scope;
+	}
+}
+
+ProjectedConstraint::ProjectedConstraint( const std::vector<int>& variables_index,
+                                          const std::shared_ptr<Constraint>& constraint,
+                                          const std::vector<int>& projection )
+	: Constraint( variables_index ),
+	  _constraint( constraint ),
+	  _projection( projection )
+{
+	std::transform( constraint->_variables.begin(),
+	                constraint->_variables.end(),
+	                std::back_inserter( _finer_variables ),
+	                []( auto variable ){ return *variable; } );
+
+	for( auto& variable : _finer_variables )
+		_finer_variables_pointers.push_back( &variable );
+}
+
+double ProjectedConstraint::required_error( const std::vector<Variable*>& variables ) const
+{
+	for( int index = 0 ; index < static_cast<int>( _finer_variables.size() ) ; ++index )
+		_finer_variables[ index ].set_value( variables[ _projection[ index ] ]->get_value() );
+
+	return _constraint->required_error( _finer_variables_pointers );
+}
+
+ProjectedObjective::ProjectedObjective( const std::vector<int>& variables_index,
+                                        const std::shared_ptr<Objective>& objective,
+                                        const std::vector<int>& projection )
+	: Objective( variables_index, objective->is_maximization(), objective->_name ),
+	  _objective( objective ),
+	  _projection( projection )
+{
+	std::transform( objective->_variables.begin(),
+	                objective->_variables.end(),
+	                std::back_inserter( _finer_variables ),
+	                []( auto variable ){ return *variable; } );
+
+	for( auto& variable : _finer_variables )
+		_finer_variables_pointers.push_back( &variable );
+}
+
+double ProjectedObjective::required_cost( const std::vector<Variable*>& variables ) const
+{
+	for( int index = 0 ; index < static_cast<int>( _finer_variables.size() ) ; ++index )
+		_finer_variables[ index ].set_value( variables[ _projection[ index ] ]->get_value() );
+
+	return _objective->required_cost( _finer_variables_pointers );
+}
+
+Multilevel::Multilevel( Model&& model, int coarsest_size, randutils::mt19937_rng& rng )
+{
+	_number_variables.push_back( static_cast<int>( model.variables.size() ) );
+	_models.push_back( std::move( model ) );
+
+	while( _number_variables.back() > coarsest_size )
+	{
+		std::vector<int> merged_into;
+		int number_coarse_variables = match_variables( _models.back(), merged_into, rng );
+
+		// Not worth another level
+		if( number_coarse_variables > 0.9 * _number_variables.back() )
+			break;
+
+		Model coarse_model = coarsen( _models.back(), merged_into, number_coarse_variables );
+		_models.push_back( std::move( coarse_model ) );
+		_merged_into.push_back( std::move( merged_into ) );
+		_number_variables.push_back( number_coarse_variables );
+	}
+}
+
+bool Multilevel::can_merge( const Model& model,
+                            const std::vector<std::vector<int>>& variable_constraints,
+                            int variable_1,
+                            int variable_2 ) const
+{
+	const auto& first = model.variables[ variable_1 ];
+	const auto& second = model.variables[ variable_2 ];
+
+	if( first.get_domain_size() != second.get_domain_size()
+	    || first.get_domain_min_value() != second.get_domain_min_value()
+	    || first.get_domain_max_value() != second.get_domain_max_value()
+	    || first.get_full_domain() != second.get_full_domain() )
+		return false;
+
+	for( int constraint_id : variable_constraints[ variable_1 ] )
+	{
+		const auto& constraint = model.constraints[ constraint_id ];
+		auto iterator = constraint->_variables_position.find( variable_2 );
+
+		if( iterator != constraint->_variables_position.end()
+		    && !constraint->optional_can_merge( constraint->_variables, constraint->_variables_position.at( variable_1 ), iterator->second ) )
+			return false;
+	}
+
+	return true;
+}
+
+int Multilevel::match_variables( const Model& model, std::vector<int>& merged_into, randutils::mt19937_rng& rng ) const
+{
+	int number_variables = static_cast<int>( model.variables.size() );
+
+	std::vector<std::vector<int>> variable_constraints( number_variables );
+	for( int constraint_id = 0 ; constraint_id < static_cast<int>( model.constraints.size() ) ; ++constraint_id )
+		for( int variable_id : model.constraints[ constraint_id ]->_variables_index )
+			variable_constraints[ variable_id ].push_back( constraint_id );
+
+	std::vector<int> order( number_variables );
+	std::iota( order.begin(), order.end(), 0 );
+	rng.shuffle( order );
+
+	std::vector<int> mates( number_variables, -1 );
+	std::vector<double> ratings( number_variables, 0.0 );
+	std::vector<int> neighbors;
+
+	for( int variable_id : order )
+	{
+		if( mates[ variable_id ] != -1 )
+			continue;
+
+		// Rate unmatched neighbors: the smaller the scope of a shared constraint, the stronger the connection.
+		for( int constraint_id : variable_constraints[ variable_id ] )
+		{
+			const auto& scope = model.constraints[ constraint_id ]->_variables_index;
+			int size = static_cast<int>( scope.size() );
+			if( size < 2 || size > max_rated_scope )
+				continue;
+
+			double weight = 1.0 / ( size - 1 );
+			for( int neighbor : scope )
+				if( neighbor != variable_id && mates[ neighbor ] == -1 )
+				{
+					if( ratings[ neighbor ] == 0.0 )
+						neighbors.push_back( neighbor );
+					ratings[ neighbor ] += weight;
+				}
+		}
+
+		std::stable_sort( neighbors.begin(), neighbors.end(), [&]( int first, int second ){ return ratings[ first ] > ratings[ second ]; } );
+
+		mates[ variable_id ] = variable_id;
+		for( int neighbor : neighbors )
+			if( can_merge( model, variable_constraints, variable_id, neighbor ) )
+			{
+				mates[ variable_id ] = neighbor;
+				mates[ neighbor ] = variable_id;
+				break;
+			}
+
+		for( int neighbor : neighbors )
+			ratings[ neighbor ] = 0.0;
+		neighbors.clear();
+	}
+
+	// Coarse variables are numbered in the order of the first variable they merge
+	merged_into.assign( number_variables, -1 );
+	int number_coarse_variables = 0;
+	for( int variable_id = 0 ; variable_id < number_variables ; ++variable_id )
+		if( merged_into[ variable_id ] == -1 )
+		{
+			merged_into[ variable_id ] = number_coarse_variables;
+			merged_into[ mates[ variable_id ] ] = number_coarse_variables;
+			++number_coarse_variables;
+		}
+
+	return number_coarse_variables;
+}
+
+Model Multilevel::coarsen( const Model& model, const std::vector<int>& merged_into, int number_coarse_variables ) const
+{
+	// Each coarse variable is a copy of the first variable it merges
+	std::vector<Variable> coarse_variables;
+	coarse_variables.reserve( number_coarse_variables );
+	for( int variable_id = 0 ; variable_id < static_cast<int>( model.variables.size() ) ; ++variable_id )
+		if( merged_into[ variable_id ] == static_cast<int>( coarse_variables.size() ) )
+			coarse_variables.push_back( model.variables[ variable_id ] );
+
+	std::vector<std::shared_ptr<Constraint>> coarse_constraints;
+	std::vector<int> projection;
+
+	for( const auto& constraint : model.constraints )
+	{
+		std::vector<int> coarse_variables_index( constraint->_variables_index.size() );
+		std::transform( constraint->_variables_index.begin(),
+		                constraint->_variables_index.end(),
+		                coarse_variables_index.begin(),
+		                [&]( int variable_id ){ return merged_into[ variable_id ]; } );
+
+		try
+		{
+			coarse_constraints.push_back( constraint->optional_coarsen( constraint->_variables, coarse_variables_index ) );
+		}
+		catch( const Constraint::coarsenNotDefinedException& e )
+		{
+			std::vector<int> scope = coarse_scope( constraint->_variables_index, merged_into, projection );
+			coarse_constraints.push_back( std::make_shared<ProjectedConstraint>( scope, constraint, projection ) );
+		}
+	}
+
+	std::shared_ptr<Objective> coarse_objective;
+	if( model.objective->is_optimization() )
+	{
+		std::vector<int> scope = coarse_scope( model.objective->_variables_index, merged_into, projection );
+		coarse_objective = std::make_shared<ProjectedObjective>( scope, model.objective, projection );
+	}
+	else
+		coarse_objective = std::make_shared<NullObjective>();
+
+	CoarseModelBuilder builder( std::move( coarse_variables ), std::move( coarse_constraints ), coarse_objective );
+	return builder.build_model();
+}
+
+std::vector<int> Multilevel::project( int level, const std::vector<int>& values ) const
+{
+	const auto& merged_into = _merged_into[ level - 1 ];
+	std::vector<int> finer_values( merged_into.size() );
+
+	std::transform( merged_into.begin(),
+	                merged_into.end(),
+	                finer_values.begin(),
+	                [&]( int coarse_id ){ return values[ coarse_id ]; } );
+
+	return finer_values;
+}
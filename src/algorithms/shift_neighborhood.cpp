@@ -0,0 +1,92 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+
+#include "algorithms/shift_neighborhood.hpp"
+
+using ghost::algorithms::ShiftNeighborhood;
+using ghost::algorithms::Move;
+using ghost::SearchUnitData;
+using ghost::Model;
+
+ShiftNeighborhood::ShiftNeighborhood( int max_distance )
+	: Neighborhood( "Shift" ),
+	  _max_distance( max_distance )
+{ }
+
+std::vector<Move> ShiftNeighborhood::get_moves( int variable_to_change,
+                                                const SearchUnitData& data,
+                                                const Model& model,
+                                                randutils::mt19937_rng& rng ) const
+{
+	std::vector<Move> moves;
+	int first = 0;
+	int last = data.number_variables - 1;
+	if( _max_distance >= 0 )
+	{
+		first = std::max( first, variable_to_change - _max_distance );
+		last = std::min( last, variable_to_change + _max_distance );
+	}
+
+	for( int position = first ; position <= last ; ++position )
+	{
+		if( position == variable_to_change )
+			continue;
+
+		// Values between the selected variable and the insertion position move by one toward the selected variable
+		int step = position > variable_to_change ? 1 : -1;
+		Move shift;
+		bool is_valid = true;
+
+		for( int variable_id = variable_to_change ; variable_id != position && is_valid ; variable_id += step )
+		{
+			int value = model.variables[ variable_id + step ].get_value();
+			if( value != model.variables[ variable_id ].get_value() )
+			{
+				is_valid = model.variables[ variable_id ].is_in_domain( value );
+				shift.variables.push_back( variable_id );
+				shift.values.push_back( value );
+			}
+		}
+
+		int value = model.variables[ variable_to_change ].get_value();
+		if( is_valid && value != model.variables[ position ].get_value() )
+		{
+			is_valid = model.variables[ position ].is_in_domain( value );
+			shift.variables.push_back( position );
+			shift.values.push_back( value );
+		}
+
+		if( is_valid && !shift.variables.empty() )
+			moves.push_back( std::move( shift ) );
+	}
+
+	return moves;
+}
@@ -39,14 +39,22 @@ Constraint::Constraint( const std::vector<int>& variables_index )
 	: _variables_index( variables_index ),
 	  _current_error( std::numeric_limits<double>::max() ),
 	  _id( 0 ),
-	  _is_optional_delta_error_defined( true )
+	  _is_optional_delta_error_defined( true ),
+	  _is_optional_delta_error_on_domain_defined( true ),
+	  _is_optional_plausible_values_defined( true ),
+	  _is_optional_batch_error_defined( true ),
+	  _is_permutation_invariant( false )
 { }
 
 Constraint::Constraint( const std::vector<Variable>& variables )
 	: _variables_index( std::vector<int>( variables.size() ) ),
 	  _current_error( std::numeric_limits<double>::max() ),
 	  _id( 0 ),
-	  _is_optional_delta_error_defined( true )
+	  _is_optional_delta_error_defined( true ),
+	  _is_optional_delta_error_on_domain_defined( true ),
+	  _is_optional_plausible_values_defined( true ),
+	  _is_optional_batch_error_defined( true ),
+	  _is_permutation_invariant( false )
 {
 	std::transform( variables.begin(),
 	                variables.end(),
@@ -113,6 +121,78 @@ double Constraint::simulate_delta( const std::vector<int>& variables_index, cons
 	}
 }
 
+std::vector<double> Constraint::delta_error_on_domain( int variable_index, const std::vector<int>& candidate_values ) const
+{
+	int variable_index_within_constraint = _variables_position.at( variable_index );
+	auto values = optional_delta_error_on_domain( _variables, variable_index_within_constraint, candidate_values );
+
+	for( int i = 0 ; i < static_cast<int>( values.size() ) ; ++i )
+		if( std::isnan( values[i] ) )
+		{
+			std::vector<Variable> changed_variables( _variables.size() );
+			std::transform( _variables.begin(),
+			                _variables.end(),
+			                changed_variables.begin(),
+			                [&]( auto& var ){ return *var; } );
+
+			changed_variables[ variable_index_within_constraint ].set_value( candidate_values[i] );
+			throw nanException( changed_variables );
+		}
+
+	return values;
+}
+
+std::vector<double> Constraint::simulate_delta_on_domain( int variable_index, const std::vector<int>& candidate_values )
+{
+	if( _is_optional_delta_error_on_domain_defined )
+		return delta_error_on_domain( variable_index, candidate_values );
+	else
+	{
+		std::vector<double> values( candidate_values.size() );
+
+		for( int i = 0 ; i < static_cast<int>( candidate_values.size() ) ; ++i )
+			values[i] = simulate_delta( std::vector<int>{variable_index}, std::vector<int>{candidate_values[i]} );
+
+		return values;
+	}
+}
+
+std::vector<int> Constraint::plausible_values( int variable_index, const std::vector<int>& candidate_values ) const
+{
+	return optional_plausible_values( _variables, _variables_position.at( variable_index ), candidate_values );
+}
+
+std::vector<double> Constraint::batch_error( const std::vector<int>& samples, int number_samples ) const
+{
+	std::vector<int> values( _variables.size() * number_samples );
+	for( int i = 0 ; i < static_cast<int>( _variables.size() ) ; ++i )
+		std::copy_n( samples.begin() + _variables_index[i] * number_samples,
+		             number_samples,
+		             values.begin() + i * number_samples );
+
+	auto errors = optional_batch_error( _variables, values, number_samples );
+
+	for( int k = 0 ; k < number_samples ; ++k )
+		if( std::isnan( errors[k] ) || errors[k] < 0 )
+		{
+			std::vector<Variable> changed_variables( _variables.size() );
+			std::transform( _variables.begin(),
+			                _variables.end(),
+			                changed_variables.begin(),
+			                [&]( auto& var ){ return *var; } );
+
+			for( int i = 0 ; i < static_cast<int>( _variables.size() ) ; ++i )
+				changed_variables[i].set_value( values[ i * number_samples + k ] );
+
+			if( std::isnan( errors[k] ) )
+				throw nanException( changed_variables );
+			else
+				throw negativeException( changed_variables );
+		}
+
+	return errors;
+}
+
 bool Constraint::has_variable( int var_id ) const
 {
 	return _variables_position.count( var_id ) > 0;
@@ -124,4 +204,42 @@ double Constraint::optional_delta_error( const std::vector<Variable*>& variables
 	throw deltaErrorNotDefinedException();
 }
 
+std::vector<double> Constraint::optional_delta_error_on_domain( const std::vector<Variable*>& variables, int variable_index, const std::vector<int>& candidate_values ) const
+{
+	_is_optional_delta_error_on_domain_defined = false;
+	throw deltaErrorOnDomainNotDefinedException();
+}
+
+std::vector<int> Constraint::optional_plausible_values( const std::vector<Variable*>& variables, int variable_index, const std::vector<int>& candidate_values ) const
+{
+	_is_optional_plausible_values_defined = false;
+	throw plausibleValuesNotDefinedException();
+}
+
+std::vector<double> Constraint::optional_batch_error( const std::vector<Variable*>& variables, const std::vector<int>& values, int number_samples ) const
+{
+	_is_optional_batch_error_defined = false;
+	throw batchErrorNotDefinedException();
+}
+
+bool Constraint::optional_is_permutation_invariant( const std::vector<Variable*>& variables ) const
+{
+	return false;
+}
+
+std::size_t Constraint::optional_memory_usage( const std::vector<Variable*>& variables ) const
+{
+	return 0;
+}
+
+bool Constraint::optional_can_merge( const std::vector<Variable*>& variables, int index_1, int index_2 ) const
+{
+	return true;
+}
+
+std::shared_ptr<Constraint> Constraint::optional_coarsen( const std::vector<Variable*>& variables, const std::vector<int>& coarse_variables_index ) const
+{
+	throw coarsenNotDefinedException();
+}
+
 void Constraint::conditional_update_data_structures( const std::vector<Variable*>& variables, int index, int new_value ) { }
@@ -0,0 +1,223 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <iterator>
+
+#include "expressions/expression.hpp"
+
+using ghost::expressions::ExpressionKind;
+using ghost::expressions::ExpressionNode;
+using ghost::expressions::Expression;
+
+namespace
+{
+	using NodePointer = std::shared_ptr<const ExpressionNode>;
+
+	std::vector<NodePointer> get_nodes( const std::vector<Expression>& expressions )
+	{
+		std::vector<NodePointer> nodes;
+		nodes.reserve( expressions.size() );
+		std::transform( expressions.begin(),
+		                expressions.end(),
+		                std::back_inserter( nodes ),
+		                []( const auto& expression ){ return expression.get_node(); } );
+		return nodes;
+	}
+
+	Expression make_expression( ExpressionKind kind, std::vector<NodePointer> children, double constant = 0.0 )
+	{
+		return Expression( std::make_shared<const ExpressionNode>( kind, std::move( children ), constant ) );
+	}
+
+	// Add coefficient * term to a weighted sum under construction, flattening nested sums and constants
+	// so that chains of additions lead to a single Sum node.
+	void add_term( ExpressionNode& sum, const NodePointer& term, double coefficient )
+	{
+		if( term->kind == ExpressionKind::Constant )
+			sum.constant += coefficient * term->constant;
+		else if( term->kind == ExpressionKind::Sum )
+		{
+			sum.constant += coefficient * term->constant;
+			for( int i = 0 ; i < static_cast<int>( term->children.size() ) ; ++i )
+			{
+				sum.children.push_back( term->children[ i ] );
+				sum.coefficients.push_back( coefficient * term->coefficients[ i ] );
+			}
+		}
+		else
+		{
+			sum.children.push_back( term );
+			sum.coefficients.push_back( coefficient );
+		}
+	}
+
+	Expression make_sum( const std::vector<NodePointer>& terms, const std::vector<double>& coefficients, double constant )
+	{
+		auto node = std::make_shared<ExpressionNode>( ExpressionKind::Sum, std::vector<NodePointer>{}, constant );
+		for( int i = 0 ; i < static_cast<int>( terms.size() ) ; ++i )
+			add_term( *node, terms[ i ], coefficients[ i ] );
+
+		return Expression( NodePointer( std::move( node ) ) );
+	}
+}
+
+ExpressionNode::ExpressionNode( ExpressionKind kind, std::vector<std::shared_ptr<const ExpressionNode>> children, double constant )
+	: kind( kind ),
+	  children( std::move( children ) ),
+	  constant( constant ),
+	  variable_id( -1 )
+{ }
+
+Expression::Expression( std::shared_ptr<const ExpressionNode> node )
+	: _node( std::move( node ) )
+{ }
+
+Expression::Expression( double value )
+	: _node( std::make_shared<const ExpressionNode>( ExpressionKind::Constant, std::vector<NodePointer>{}, value ) )
+{ }
+
+Expression::Expression( int value )
+	: Expression( static_cast<double>( value ) )
+{ }
+
+Expression::Expression( const Variable& variable )
+	: Expression( ghost::expressions::variable( variable.get_id() ) )
+{ }
+
+Expression ghost::expressions::variable( int variable_id )
+{
+	auto node = std::make_shared<ExpressionNode>( ExpressionKind::Variable );
+	node->variable_id = variable_id;
+	return Expression( NodePointer( std::move( node ) ) );
+}
+
+Expression ghost::expressions::sum( const std::vector<Expression>& terms )
+{
+	return make_sum( get_nodes( terms ), std::vector<double>( terms.size(), 1.0 ), 0.0 );
+}
+
+Expression ghost::expressions::sum( const std::vector<Expression>& terms, const std::vector<double>& coefficients, double constant )
+{
+	return make_sum( get_nodes( terms ), coefficients, constant );
+}
+
+Expression ghost::expressions::sum( const std::vector<Variable>& variables )
+{
+	return sum( std::vector<Expression>( variables.begin(), variables.end() ) );
+}
+
+Expression ghost::expressions::product( const std::vector<Expression>& factors )
+{
+	return make_expression( ExpressionKind::Product, get_nodes( factors ) );
+}
+
+Expression ghost::expressions::minimum( const std::vector<Expression>& terms )
+{
+	return make_expression( ExpressionKind::Minimum, get_nodes( terms ) );
+}
+
+Expression ghost::expressions::maximum( const std::vector<Expression>& terms )
+{
+	return make_expression( ExpressionKind::Maximum, get_nodes( terms ) );
+}
+
+Expression ghost::expressions::absolute( const Expression& term )
+{
+	return make_expression( ExpressionKind::Absolute, { term.get_node() } );
+}
+
+Expression ghost::expressions::equal( const Expression& lhs, const Expression& rhs )
+{
+	return make_expression( ExpressionKind::Equal, { lhs.get_node(), rhs.get_node() } );
+}
+
+Expression ghost::expressions::not_equal( const Expression& lhs, const Expression& rhs )
+{
+	return make_expression( ExpressionKind::NotEqual, { lhs.get_node(), rhs.get_node() } );
+}
+
+Expression ghost::expressions::less_equal( const Expression& lhs, const Expression& rhs )
+{
+	return make_expression( ExpressionKind::LessEqual, { lhs.get_node(), rhs.get_node() } );
+}
+
+Expression ghost::expressions::less( const Expression& lhs, const Expression& rhs )
+{
+	return make_expression( ExpressionKind::Less, { lhs.get_node(), rhs.get_node() } );
+}
+
+Expression ghost::expressions::greater_equal( const Expression& lhs, const Expression& rhs )
+{
+	return less_equal( rhs, lhs );
+}
+
+Expression ghost::expressions::greater( const Expression& lhs, const Expression& rhs )
+{
+	return less( rhs, lhs );
+}
+
+Expression ghost::expressions::element( const Expression& index, const std::vector<double>& array )
+{
+	auto node = std::make_shared<ExpressionNode>( ExpressionKind::Element, std::vector<NodePointer>{ index.get_node() } );
+	node->array = array;
+	return Expression( NodePointer( std::move( node ) ) );
+}
+
+Expression ghost::expressions::count( const std::vector<Expression>& terms, double value )
+{
+	return make_expression( ExpressionKind::Count, get_nodes( terms ), value );
+}
+
+Expression ghost::expressions::operator+( const Expression& lhs, const Expression& rhs )
+{
+	return make_sum( { lhs.get_node(), rhs.get_node() }, { 1.0, 1.0 }, 0.0 );
+}
+
+Expression ghost::expressions::operator-( const Expression& lhs, const Expression& rhs )
+{
+	return make_sum( { lhs.get_node(), rhs.get_node() }, { 1.0, -1.0 }, 0.0 );
+}
+
+Expression ghost::expressions::operator-( const Expression& term )
+{
+	return make_sum( { term.get_node() }, { -1.0 }, 0.0 );
+}
+
+Expression ghost::expressions::operator*( const Expression& lhs, const Expression& rhs )
+{
+	// Products by a constant are weighted sums, evaluated incrementally
+	if( lhs.get_node()->kind == ExpressionKind::Constant )
+		return make_sum( { rhs.get_node() }, { lhs.get_node()->constant }, 0.0 );
+
+	if( rhs.get_node()->kind == ExpressionKind::Constant )
+		return make_sum( { lhs.get_node() }, { rhs.get_node()->constant }, 0.0 );
+
+	return product( { lhs, rhs } );
+}
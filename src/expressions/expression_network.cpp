@@ -0,0 +1,276 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+#include "expressions/expression_network.hpp"
+
+using ghost::expressions::ExpressionNetwork;
+using ghost::expressions::ExpressionKind;
+using ghost::expressions::ExpressionNode;
+
+ExpressionNetwork::ExpressionNetwork( const Expression& root )
+	: _stamp( 0 )
+{
+	std::unordered_map<const ExpressionNode*, int> node_indexes;
+	std::map<int, int> variable_nodes; // variable ID -> node, to share a single node per variable
+
+	// Iterative post-order DFS, so that children get smaller indexes than their parents
+	std::vector<std::pair<const ExpressionNode*, int>> stack{ { root.get_node().get(), 0 } };
+	_children_start.push_back( 0 );
+	_arrays_start.push_back( 0 );
+
+	while( !stack.empty() )
+	{
+		auto& [ node, next_child ] = stack.back();
+
+		if( next_child < static_cast<int>( node->children.size() ) )
+		{
+			const ExpressionNode* child = node->children[ next_child++ ].get();
+			if( node_indexes.find( child ) == node_indexes.end() )
+				stack.emplace_back( child, 0 );
+			continue;
+		}
+
+		stack.pop_back();
+		if( node_indexes.find( node ) != node_indexes.end() )
+			continue;
+
+		if( node->kind == ExpressionKind::Variable )
+		{
+			auto iterator = variable_nodes.find( node->variable_id );
+			if( iterator != variable_nodes.end() )
+			{
+				node_indexes[ node ] = iterator->second;
+				continue;
+			}
+			variable_nodes[ node->variable_id ] = static_cast<int>( _kinds.size() );
+		}
+
+		node_indexes[ node ] = static_cast<int>( _kinds.size() );
+		_kinds.push_back( node->kind );
+		_constants.push_back( node->constant );
+
+		for( int i = 0 ; i < static_cast<int>( node->children.size() ) ; ++i )
+		{
+			_children.push_back( node_indexes.at( node->children[ i ].get() ) );
+			_coefficients.push_back( node->kind == ExpressionKind::Sum ? node->coefficients[ i ] : 1.0 );
+		}
+		_children_start.push_back( static_cast<int>( _children.size() ) );
+
+		_arrays.insert( _arrays.end(), node->array.begin(), node->array.end() );
+		_arrays_start.push_back( static_cast<int>( _arrays.size() ) );
+	}
+
+	int number_nodes = static_cast<int>( _kinds.size() );
+
+	// Parents, with the slot of the child in its parent (a node can be a child of the same parent several times)
+	std::vector<int> number_parents( number_nodes, 0 );
+	for( int child : _children )
+		++number_parents[ child ];
+
+	_parents_start.assign( number_nodes + 1, 0 );
+	for( int node = 0 ; node < number_nodes ; ++node )
+		_parents_start[ node + 1 ] = _parents_start[ node ] + number_parents[ node ];
+
+	_parents.resize( _children.size() );
+	_parents_slot.resize( _children.size() );
+	std::vector<int> next_parent( _parents_start.begin(), _parents_start.end() - 1 );
+	for( int node = 0 ; node < number_nodes ; ++node )
+		for( int slot = 0 ; slot < _children_start[ node + 1 ] - _children_start[ node ] ; ++slot )
+		{
+			int child = _children[ _children_start[ node ] + slot ];
+			_parents[ next_parent[ child ] ] = node;
+			_parents_slot[ next_parent[ child ] ] = slot;
+			++next_parent[ child ];
+		}
+
+	for( const auto& [ variable_id, node ] : variable_nodes )
+	{
+		_variable_ids.push_back( variable_id );
+		_variable_nodes.push_back( node );
+	}
+
+	_values.assign( number_nodes, 0.0 );
+	_touched_stamps.assign( number_nodes, -1 );
+	_queued_stamps.assign( number_nodes, -1 );
+	_new_values.assign( number_nodes, 0.0 );
+	_pending.assign( number_nodes, 0.0 );
+}
+
+double ExpressionNetwork::evaluate_node( int node ) const
+{
+	int start = _children_start[ node ];
+	int end = _children_start[ node + 1 ];
+
+	switch( _kinds[ node ] )
+	{
+	case ExpressionKind::Constant:
+		return _constants[ node ];
+	case ExpressionKind::Variable:
+		return current_value( node );
+	case ExpressionKind::Sum:
+	{
+		double value = _constants[ node ];
+		for( int i = start ; i < end ; ++i )
+			value += _coefficients[ i ] * current_value( _children[ i ] );
+		return value;
+	}
+	case ExpressionKind::Product:
+	{
+		double value = 1.0;
+		for( int i = start ; i < end ; ++i )
+			value *= current_value( _children[ i ] );
+		return value;
+	}
+	case ExpressionKind::Minimum:
+	case ExpressionKind::Maximum:
+	{
+		if( start == end )
+			return 0.0;
+		double value = current_value( _children[ start ] );
+		for( int i = start + 1 ; i < end ; ++i )
+			value = _kinds[ node ] == ExpressionKind::Minimum ? std::min( value, current_value( _children[ i ] ) ) : std::max( value, current_value( _children[ i ] ) );
+		return value;
+	}
+	case ExpressionKind::Absolute:
+		return std::abs( current_value( _children[ start ] ) );
+	case ExpressionKind::Equal:
+		return std::abs( current_value( _children[ start ] ) - current_value( _children[ start + 1 ] ) );
+	case ExpressionKind::NotEqual:
+		return current_value( _children[ start ] ) == current_value( _children[ start + 1 ] ) ? 1.0 : 0.0;
+	case ExpressionKind::LessEqual:
+		return std::max( 0.0, current_value( _children[ start ] ) - current_value( _children[ start + 1 ] ) );
+	case ExpressionKind::Less:
+		return std::max( 0.0, current_value( _children[ start ] ) - current_value( _children[ start + 1 ] ) + 1 );
+	case ExpressionKind::Element:
+	{
+		long size = _arrays_start[ node + 1 ] - _arrays_start[ node ];
+		long index = std::clamp( std::lround( current_value( _children[ start ] ) ), 0L, size - 1 );
+		return _arrays[ _arrays_start[ node ] + index ];
+	}
+	case ExpressionKind::Count:
+	{
+		double value = 0.0;
+		for( int i = start ; i < end ; ++i )
+			if( current_value( _children[ i ] ) == _constants[ node ] )
+				++value;
+		return value;
+	}
+	}
+
+	return 0.0;
+}
+
+void ExpressionNetwork::change_node( int node, double new_value )
+{
+	double old_value = current_value( node );
+	if( new_value == old_value )
+		return;
+
+	if( _touched_stamps[ node ] != _stamp )
+	{
+		_touched_stamps[ node ] = _stamp;
+		_touched_nodes.push_back( node );
+	}
+	_new_values[ node ] = new_value;
+
+	for( int i = _parents_start[ node ] ; i < _parents_start[ node + 1 ] ; ++i )
+	{
+		int parent = _parents[ i ];
+		if( _queued_stamps[ parent ] != _stamp )
+		{
+			_queued_stamps[ parent ] = _stamp;
+			_pending[ parent ] = 0.0;
+			_queue.push( parent );
+		}
+
+		if( _kinds[ parent ] == ExpressionKind::Sum )
+			_pending[ parent ] += _coefficients[ _children_start[ parent ] + _parents_slot[ i ] ] * ( new_value - old_value );
+		else if( _kinds[ parent ] == ExpressionKind::Count )
+			_pending[ parent ] += ( new_value == _constants[ parent ] ? 1.0 : 0.0 ) - ( old_value == _constants[ parent ] ? 1.0 : 0.0 );
+	}
+}
+
+double ExpressionNetwork::propagate( const std::vector<int>& variable_positions, const std::vector<int>& new_values )
+{
+	++_stamp;
+	_touched_nodes.clear();
+
+	for( int i = 0 ; i < static_cast<int>( variable_positions.size() ) ; ++i )
+		change_node( _variable_nodes[ variable_positions[ i ] ], new_values[ i ] );
+
+	// Children have smaller indexes than their parents: popping the smallest queued node first
+	// guarantees all its changed children have been processed.
+	while( !_queue.empty() )
+	{
+		int node = _queue.top();
+		_queue.pop();
+
+		if( _kinds[ node ] == ExpressionKind::Sum || _kinds[ node ] == ExpressionKind::Count )
+			change_node( node, _values[ node ] + _pending[ node ] );
+		else
+			change_node( node, evaluate_node( node ) );
+	}
+
+	return current_value( static_cast<int>( _values.size() ) - 1 );
+}
+
+double ExpressionNetwork::evaluate( const std::vector<Variable*>& variables )
+{
+	// New stamp: no nodes are touched
+	++_stamp;
+
+	for( int position = 0 ; position < static_cast<int>( _variable_nodes.size() ) ; ++position )
+		_values[ _variable_nodes[ position ] ] = variables[ position ]->get_value();
+
+	for( int node = 0 ; node < static_cast<int>( _values.size() ) ; ++node )
+		if( _kinds[ node ] != ExpressionKind::Variable )
+			_values[ node ] = evaluate_node( node );
+
+	return _values.back();
+}
+
+double ExpressionNetwork::simulate( const std::vector<int>& variable_positions, const std::vector<int>& new_values )
+{
+	// Scratch values are discarded by the next propagation
+	return propagate( variable_positions, new_values );
+}
+
+void ExpressionNetwork::update( int variable_position, int new_value )
+{
+	propagate( std::vector<int>{ variable_position }, std::vector<int>{ new_value } );
+
+	for( int node : _touched_nodes )
+		_values[ node ] = _new_values[ node ];
+}
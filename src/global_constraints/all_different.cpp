@@ -99,6 +99,67 @@ double AllDifferent::optional_delta_error( const std::vector<Variable*>& variabl
 	return diff;
 }
 
+// The error is the number of pairs of variables sharing the same value. On small scopes, pairs are
+// compared across the whole batch at once, otherwise values of each sample are sorted and counted.
+std::vector<double> AllDifferent::optional_batch_error( const std::vector<Variable*>& variables,
+                                                        const std::vector<int>& values,
+                                                        int number_samples ) const
+{
+	std::vector<double> errors( number_samples, 0.0 );
+	int number_variables = static_cast<int>( variables.size() );
+
+	if( number_variables <= 32 )
+	{
+		for( int i = 0 ; i < number_variables - 1 ; ++i )
+			for( int j = i + 1 ; j < number_variables ; ++j )
+			{
+				const int* row_i = values.data() + i * number_samples;
+				const int* row_j = values.data() + j * number_samples;
+				for( int k = 0 ; k < number_samples ; ++k )
+					errors[k] += ( row_i[k] == row_j[k] );
+			}
+	}
+	else
+	{
+		std::vector<int> sample( number_variables );
+		for( int k = 0 ; k < number_samples ; ++k )
+		{
+			for( int i = 0 ; i < number_variables ; ++i )
+				sample[i] = values[ i * number_samples + k ];
+			std::sort( sample.begin(), sample.end() );
+
+			int count = 1;
+			for( int i = 1 ; i <= number_variables ; ++i )
+				if( i < number_variables && sample[i] == sample[i - 1] )
+					++count;
+				else
+				{
+					errors[k] += binomial_with_2( count );
+					count = 1;
+				}
+		}
+	}
+
+	return errors;
+}
+
+// Moving a variable from a value taken c times to a value taken k times changes the error by k - (c - 1)
+std::vector<int> AllDifferent::optional_plausible_values( const std::vector<Variable*>& variables, int variable_index, const std::vector<int>& candidate_values ) const
+{
+	std::vector<int> plausible_values;
+	int current_count = _count.at( variables[ variable_index ]->get_value() );
+
+	if( current_count > 1 )
+		for( const int value : candidate_values )
+		{
+			auto iterator = _count.find( value );
+			if( iterator == _count.end() || iterator->second < current_count - 1 )
+				plausible_values.push_back( value );
+		}
+
+	return plausible_values;
+}
+
 void AllDifferent::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
 {
 	_count[ variables[ variable_index ]->get_value() ] = _count[ variables[ variable_index ]->get_value() ] - 1;
@@ -108,3 +169,19 @@ void AllDifferent::conditional_update_data_structures( const std::vector<Variabl
 	else
 		_count[ new_value ] = _count[ new_value ] + 1;	
 }
+
+bool AllDifferent::optional_is_permutation_invariant( const std::vector<Variable*>& variables ) const
+{
+	return true;
+}
+
+std::size_t AllDifferent::optional_memory_usage( const std::vector<Variable*>& variables ) const
+{
+	return MemoryUsage::heap_bytes( _count );
+}
+
+bool AllDifferent::optional_can_merge( const std::vector<Variable*>& variables, int index_1, int index_2 ) const
+{
+	// Merged variables would take the same value
+	return false;
+}
@@ -0,0 +1,167 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <map>
+
+#include "global_constraints/bin_packing.hpp"
+
+using ghost::global_constraints::BinPacking;
+using ghost::Constraint;
+
+BinPacking::BinPacking( const std::vector<int>& variables_index,
+                        const std::vector<double>& weights,
+                        const std::vector<double>& capacities )
+	: Constraint( variables_index ),
+	  _weights( weights ),
+	  _capacities( capacities ),
+	  _loads( capacities.size(), 0.0 ),
+	  _unpacked_load( 0.0 )
+{ }
+
+BinPacking::BinPacking( const std::vector<int>& variables_index,
+                        const std::vector<double>& weights,
+                        int number_bins,
+                        double capacity )
+	: BinPacking( variables_index, weights, std::vector<double>( number_bins, capacity ) )
+{ }
+
+BinPacking::BinPacking( const std::vector<Variable>& variables,
+                        const std::vector<double>& weights,
+                        const std::vector<double>& capacities )
+	: Constraint( variables ),
+	  _weights( weights ),
+	  _capacities( capacities ),
+	  _loads( capacities.size(), 0.0 ),
+	  _unpacked_load( 0.0 )
+{ }
+
+BinPacking::BinPacking( const std::vector<Variable>& variables,
+                        const std::vector<double>& weights,
+                        int number_bins,
+                        double capacity )
+	: BinPacking( variables, weights, std::vector<double>( number_bins, capacity ) )
+{ }
+
+double BinPacking::required_error( const std::vector<Variable*>& variables ) const
+{
+	std::fill( _loads.begin(), _loads.end(), 0.0 );
+	_unpacked_load = 0.0;
+
+	double error = 0.0;
+	for( int item = 0 ; item < static_cast<int>( variables.size() ) ; ++item )
+		error += add_to_bin( variables[ item ]->get_value(), _weights[ item ] );
+
+	return error;
+}
+
+double BinPacking::optional_delta_error( const std::vector<Variable*>& variables,
+                                         const std::vector<int>& variable_indexes,
+                                         const std::vector<int>& candidate_values ) const
+{
+	double diff = 0.0;
+
+	// Move items one after the other, then put them back.
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		int item = variable_indexes[ i ];
+		diff += add_to_bin( variables[ item ]->get_value(), -_weights[ item ] );
+		diff += add_to_bin( candidate_values[ i ], _weights[ item ] );
+	}
+
+	for( int i = static_cast<int>( variable_indexes.size() ) - 1 ; i >= 0 ; --i )
+	{
+		int item = variable_indexes[ i ];
+		add_to_bin( candidate_values[ i ], -_weights[ item ] );
+		add_to_bin( variables[ item ]->get_value(), _weights[ item ] );
+	}
+
+	return diff;
+}
+
+std::vector<double> BinPacking::optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+                                                                int variable_index,
+                                                                const std::vector<int>& candidate_values ) const
+{
+	std::vector<double> deltas( candidate_values.size() );
+	int current_bin = variables[ variable_index ]->get_value();
+	double weight = _weights[ variable_index ];
+
+	// The variation due to removing the item from its bin is the same for all candidates.
+	double removal = add_to_bin( current_bin, -weight );
+
+	for( int i = 0 ; i < static_cast<int>( candidate_values.size() ) ; ++i )
+	{
+		int bin = candidate_values[ i ];
+		if( bin < 0 || bin >= static_cast<int>( _loads.size() ) )
+			deltas[ i ] = removal + weight;
+		else
+			deltas[ i ] = removal
+				+ std::max( 0.0, _loads[ bin ] + weight - _capacities[ bin ] )
+				- std::max( 0.0, _loads[ bin ] - _capacities[ bin ] );
+	}
+
+	add_to_bin( current_bin, weight );
+
+	return deltas;
+}
+
+void BinPacking::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	add_to_bin( variables[ variable_index ]->get_value(), -_weights[ variable_index ] );
+	add_to_bin( new_value, _weights[ variable_index ] );
+}
+
+bool BinPacking::optional_can_merge( const std::vector<Variable*>& variables, int index_1, int index_2 ) const
+{
+	// Merged items go to the same bin: they must fit together in at least one bin
+	return _capacities.empty() || _weights[ index_1 ] + _weights[ index_2 ] <= *std::max_element( _capacities.begin(), _capacities.end() );
+}
+
+std::shared_ptr<Constraint> BinPacking::optional_coarsen( const std::vector<Variable*>& variables,
+                                                          const std::vector<int>& coarse_variables_index ) const
+{
+	// Merged items are packed together, like one item of the sum of their weights
+	std::vector<int> coarse_scope;
+	std::vector<double> coarse_weights;
+	std::map<int,int> positions;
+
+	for( int item = 0 ; item < static_cast<int>( coarse_variables_index.size() ) ; ++item )
+	{
+		auto [ iterator, is_new ] = positions.emplace( coarse_variables_index[ item ], static_cast<int>( coarse_scope.size() ) );
+		if( is_new )
+		{
+			coarse_scope.push_back( coarse_variables_index[ item ] );
+			coarse_weights.push_back( _weights[ item ] );
+		}
+		else
+			coarse_weights[ iterator->second ] += _weights[ item ];
+	}
+
+	return std::make_shared<BinPacking>( coarse_scope, coarse_weights, _capacities );
+}
@@ -0,0 +1,183 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <numeric>
+
+#include "global_constraints/circuit.hpp"
+
+using ghost::global_constraints::Circuit;
+
+Circuit::Circuit( const std::vector<int>& variables_index )
+	: Constraint( variables_index ),
+	  _successors( variables_index.size(), 0 ),
+	  _in_degrees( variables_index.size(), 0 ),
+	  _nodes_without_predecessor( 0 ),
+	  _cycles( variables_index.size(), -1 ),
+	  _cycles_outdated( true )
+{ }
+
+Circuit::Circuit( const std::vector<Variable>& variables )
+	: Constraint( variables ),
+	  _successors( variables.size(), 0 ),
+	  _in_degrees( variables.size(), 0 ),
+	  _nodes_without_predecessor( 0 ),
+	  _cycles( variables.size(), -1 ),
+	  _cycles_outdated( true )
+{ }
+
+double Circuit::compute_error( const std::vector<int>& successors ) const
+{
+	int size = static_cast<int>( successors.size() );
+	std::vector<int> roots( size );
+	std::iota( roots.begin(), roots.end(), 0 );
+	std::vector<bool> has_predecessor( size, false );
+
+	auto find = [&]( int node )
+	{
+		while( roots[ node ] != node )
+		{
+			roots[ node ] = roots[ roots[ node ] ];
+			node = roots[ node ];
+		}
+		return node;
+	};
+
+	int components = size;
+	int nodes_without_predecessor = size;
+
+	for( int node = 0 ; node < size ; ++node )
+	{
+		int successor = successors[ node ];
+		if( !is_node( successor ) )
+			continue;
+
+		if( !has_predecessor[ successor ] )
+		{
+			has_predecessor[ successor ] = true;
+			--nodes_without_predecessor;
+		}
+
+		int root_node = find( node );
+		int root_successor = find( successor );
+		if( root_node != root_successor )
+		{
+			roots[ root_node ] = root_successor;
+			--components;
+		}
+	}
+
+	return nodes_without_predecessor + components - 1;
+}
+
+void Circuit::update_cycles() const
+{
+	if( !_cycles_outdated )
+		return;
+
+	std::fill( _cycles.begin(), _cycles.end(), -1 );
+	int label = 0;
+
+	for( int node = 0 ; node < static_cast<int>( _successors.size() ) ; ++node )
+		if( _cycles[ node ] == -1 )
+		{
+			for( int current = node ; _cycles[ current ] == -1 ; current = _successors[ current ] )
+				_cycles[ current ] = label;
+			++label;
+		}
+
+	_cycles_outdated = false;
+}
+
+double Circuit::required_error( const std::vector<Variable*>& variables ) const
+{
+	std::fill( _in_degrees.begin(), _in_degrees.end(), 0 );
+	_nodes_without_predecessor = static_cast<int>( variables.size() );
+
+	for( int node = 0 ; node < static_cast<int>( variables.size() ) ; ++node )
+	{
+		_successors[ node ] = variables[ node ]->get_value();
+		if( is_node( _successors[ node ] ) && _in_degrees[ _successors[ node ] ]++ == 0 )
+			--_nodes_without_predecessor;
+	}
+
+	_cycles_outdated = true;
+	return compute_error( _successors );
+}
+
+double Circuit::optional_delta_error( const std::vector<Variable*>& variables,
+                                      const std::vector<int>& variable_indexes,
+                                      const std::vector<int>& candidate_values ) const
+{
+	// Successors form a permutation: changing one successor or swapping two successors
+	// respectively merge or split cycles, in a way that only depends on cycle labels.
+	if( _nodes_without_predecessor == 0 )
+	{
+		if( variable_indexes.size() == 1 && is_node( candidate_values[ 0 ] ) )
+		{
+			int node = variable_indexes[ 0 ];
+			if( candidate_values[ 0 ] == _successors[ node ] )
+				return 0.0;
+
+			// The old successor loses its predecessor, and the cycle of 'node' becomes
+			// a path hanging to the cycle of its new successor if it is a different one.
+			update_cycles();
+			return _cycles[ node ] == _cycles[ candidate_values[ 0 ] ] ? 1.0 : 0.0;
+		}
+
+		if( variable_indexes.size() == 2
+		    && variable_indexes[ 0 ] != variable_indexes[ 1 ]
+		    && candidate_values[ 0 ] == _successors[ variable_indexes[ 1 ] ]
+		    && candidate_values[ 1 ] == _successors[ variable_indexes[ 0 ] ] )
+		{
+			// Swapping successors splits a cycle in two, or merges two cycles.
+			update_cycles();
+			return _cycles[ variable_indexes[ 0 ] ] == _cycles[ variable_indexes[ 1 ] ] ? 1.0 : -1.0;
+		}
+	}
+
+	std::vector<int> successors( _successors );
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+		successors[ variable_indexes[ i ] ] = candidate_values[ i ];
+
+	return compute_error( successors ) - get_current_error();
+}
+
+void Circuit::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	int old_value = _successors[ variable_index ];
+
+	if( is_node( old_value ) && --_in_degrees[ old_value ] == 0 )
+		++_nodes_without_predecessor;
+
+	if( is_node( new_value ) && _in_degrees[ new_value ]++ == 0 )
+		--_nodes_without_predecessor;
+
+	_successors[ variable_index ] = new_value;
+	_cycles_outdated = true;
+}
@@ -0,0 +1,128 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "global_constraints/cumulative.hpp"
+
+using ghost::global_constraints::Cumulative;
+
+Cumulative::Cumulative( const std::vector<int>& variables_index,
+                        const std::vector<int>& durations,
+                        const std::vector<int>& demands,
+                        int capacity )
+	: Constraint( variables_index ),
+	  _durations( durations ),
+	  _demands( demands ),
+	  _capacity( capacity ),
+	  _horizon_start( 0 )
+{ }
+
+Cumulative::Cumulative( const std::vector<Variable>& variables,
+                        const std::vector<int>& durations,
+                        const std::vector<int>& demands,
+                        int capacity )
+	: Constraint( variables ),
+	  _durations( durations ),
+	  _demands( demands ),
+	  _capacity( capacity ),
+	  _horizon_start( 0 )
+{ }
+
+double Cumulative::add_to_profile( int start, int duration, int demand ) const
+{
+	double diff = 0.0;
+	int from = start - _horizon_start;
+
+	for( int time = from ; time < from + duration ; ++time )
+	{
+		diff += std::max( 0, _load[ time ] + demand - _capacity ) - std::max( 0, _load[ time ] - _capacity );
+		_load[ time ] += demand;
+	}
+
+	return diff;
+}
+
+double Cumulative::required_error( const std::vector<Variable*>& variables ) const
+{
+	// Domains never change: the horizon only needs to be computed once.
+	if( _load.empty() )
+	{
+		int horizon_end = std::numeric_limits<int>::min();
+		_horizon_start = std::numeric_limits<int>::max();
+
+		for( int index = 0 ; index < static_cast<int>( variables.size() ) ; ++index )
+		{
+			_horizon_start = std::min( _horizon_start, variables[ index ]->get_domain_min_value() );
+			horizon_end = std::max( horizon_end, variables[ index ]->get_domain_max_value() + _durations[ index ] );
+		}
+
+		_load.resize( std::max( 0, horizon_end - _horizon_start ) );
+	}
+
+	std::fill( _load.begin(), _load.end(), 0 );
+
+	double error = 0.0;
+	for( int index = 0 ; index < static_cast<int>( variables.size() ) ; ++index )
+		error += add_to_profile( variables[ index ]->get_value(), _durations[ index ], _demands[ index ] );
+
+	return error;
+}
+
+double Cumulative::optional_delta_error( const std::vector<Variable*>& variables,
+                                         const std::vector<int>& variable_indexes,
+                                         const std::vector<int>& candidate_values ) const
+{
+	double diff = 0.0;
+
+	// Move tasks one after the other on the profile, so that overlapping moves are correctly
+	// taken into account, then put the profile back in its current state.
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		int task = variable_indexes[ i ];
+		diff += add_to_profile( variables[ task ]->get_value(), _durations[ task ], -_demands[ task ] );
+		diff += add_to_profile( candidate_values[ i ], _durations[ task ], _demands[ task ] );
+	}
+
+	for( int i = static_cast<int>( variable_indexes.size() ) - 1 ; i >= 0 ; --i )
+	{
+		int task = variable_indexes[ i ];
+		add_to_profile( candidate_values[ i ], _durations[ task ], -_demands[ task ] );
+		add_to_profile( variables[ task ]->get_value(), _durations[ task ], _demands[ task ] );
+	}
+
+	return diff;
+}
+
+void Cumulative::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	add_to_profile( variables[ variable_index ]->get_value(), _durations[ variable_index ], -_demands[ variable_index ] );
+	add_to_profile( new_value, _durations[ variable_index ], _demands[ variable_index ] );
+}
@@ -0,0 +1,88 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include "global_constraints/element.hpp"
+
+using ghost::global_constraints::Element;
+
+Element::Element( int index_variable, int value_variable, const std::vector<int>& array )
+	: Constraint( std::vector<int>{ index_variable, value_variable } ),
+	  _array( array )
+{
+	if( _array.empty() )
+		throw emptyArrayException();
+}
+
+Element::Element( const Variable& index_variable, const Variable& value_variable, const std::vector<int>& array )
+	: Constraint( std::vector<Variable>{ index_variable, value_variable } ),
+	  _array( array )
+{
+	if( _array.empty() )
+		throw emptyArrayException();
+}
+
+double Element::required_error( const std::vector<Variable*>& variables ) const
+{
+	return compute_error( variables[ 0 ]->get_value(), variables[ 1 ]->get_value() );
+}
+
+double Element::optional_delta_error( const std::vector<Variable*>& variables,
+                                      const std::vector<int>& variable_indexes,
+                                      const std::vector<int>& candidate_values ) const
+{
+	int values[2] = { variables[ 0 ]->get_value(), variables[ 1 ]->get_value() };
+
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+		values[ variable_indexes[ i ] ] = candidate_values[ i ];
+
+	return compute_error( values[ 0 ], values[ 1 ] ) - compute_error( variables[ 0 ]->get_value(), variables[ 1 ]->get_value() );
+}
+
+std::vector<double> Element::optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+                                                             int variable_index,
+                                                             const std::vector<int>& candidate_values ) const
+{
+	int index = variables[ 0 ]->get_value();
+	int value = variables[ 1 ]->get_value();
+	double current_error = compute_error( index, value );
+	int size = static_cast<int>( candidate_values.size() );
+	std::vector<double> deltas( size );
+
+	if( variable_index == 0 )
+		for( int i = 0 ; i < size ; ++i )
+			deltas[ i ] = compute_error( candidate_values[ i ], value ) - current_error;
+	else
+	{
+		int array_value = _array[ std::clamp( index, 0, static_cast<int>( _array.size() ) - 1 ) ];
+		for( int i = 0 ; i < size ; ++i )
+			deltas[ i ] = std::abs( array_value - candidate_values[ i ] ) - std::abs( array_value - value );
+	}
+
+	return deltas;
+}
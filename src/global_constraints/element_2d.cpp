@@ -0,0 +1,101 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include "global_constraints/element_2d.hpp"
+
+using ghost::global_constraints::Element2D;
+
+Element2D::Element2D( int row_variable, int column_variable, int value_variable, const std::vector<std::vector<int>>& matrix )
+	: Constraint( std::vector<int>{ row_variable, column_variable, value_variable } )
+{
+	flatten( matrix );
+}
+
+Element2D::Element2D( const Variable& row_variable,
+                      const Variable& column_variable,
+                      const Variable& value_variable,
+                      const std::vector<std::vector<int>>& matrix )
+	: Constraint( std::vector<Variable>{ row_variable, column_variable, value_variable } )
+{
+	flatten( matrix );
+}
+
+void Element2D::flatten( const std::vector<std::vector<int>>& matrix )
+{
+	if( matrix.empty() || matrix[ 0 ].empty() )
+		throw matrixException( "Element2D constraints need a non-empty matrix.\n" );
+
+	_number_rows = static_cast<int>( matrix.size() );
+	_number_columns = static_cast<int>( matrix[ 0 ].size() );
+
+	for( int row = 1 ; row < _number_rows ; ++row )
+		if( static_cast<int>( matrix[ row ].size() ) != _number_columns )
+			throw matrixException( "Row " + std::to_string( row ) + " of the Element2D matrix has " + std::to_string( matrix[ row ].size() )
+			                       + " columns, but row 0 has " + std::to_string( _number_columns ) + ".\n" );
+
+	_matrix.reserve( _number_rows * _number_columns );
+	for( const auto& row : matrix )
+		_matrix.insert( _matrix.end(), row.begin(), row.end() );
+}
+
+double Element2D::required_error( const std::vector<Variable*>& variables ) const
+{
+	return compute_error( variables[ 0 ]->get_value(), variables[ 1 ]->get_value(), variables[ 2 ]->get_value() );
+}
+
+double Element2D::optional_delta_error( const std::vector<Variable*>& variables,
+                                        const std::vector<int>& variable_indexes,
+                                        const std::vector<int>& candidate_values ) const
+{
+	int values[3] = { variables[ 0 ]->get_value(), variables[ 1 ]->get_value(), variables[ 2 ]->get_value() };
+	double current_error = compute_error( values[ 0 ], values[ 1 ], values[ 2 ] );
+
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+		values[ variable_indexes[ i ] ] = candidate_values[ i ];
+
+	return compute_error( values[ 0 ], values[ 1 ], values[ 2 ] ) - current_error;
+}
+
+std::vector<double> Element2D::optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+                                                               int variable_index,
+                                                               const std::vector<int>& candidate_values ) const
+{
+	int values[3] = { variables[ 0 ]->get_value(), variables[ 1 ]->get_value(), variables[ 2 ]->get_value() };
+	double current_error = compute_error( values[ 0 ], values[ 1 ], values[ 2 ] );
+	int size = static_cast<int>( candidate_values.size() );
+	std::vector<double> deltas( size );
+
+	for( int i = 0 ; i < size ; ++i )
+	{
+		values[ variable_index ] = candidate_values[ i ];
+		deltas[ i ] = compute_error( values[ 0 ], values[ 1 ], values[ 2 ] ) - current_error;
+	}
+
+	return deltas;
+}
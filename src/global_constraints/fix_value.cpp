@@ -62,3 +62,18 @@ double FixValue::optional_delta_error( const std::vector<Variable*>& variables,
 	
 	return diff;
 } 
+
+std::vector<double> FixValue::optional_batch_error( const std::vector<Variable*>& variables,
+                                                    const std::vector<int>& values,
+                                                    int number_samples ) const
+{
+	std::vector<double> errors( number_samples, 0. );
+	for( size_t i = 0 ; i < variables.size() ; ++i )
+	{
+		const int* row = values.data() + i * number_samples;
+		for( int k = 0 ; k < number_samples ; ++k )
+			errors[k] += std::abs( row[k] - _value );
+	}
+
+	return errors;
+}
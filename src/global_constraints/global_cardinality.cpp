@@ -0,0 +1,208 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+
+#include "global_constraints/global_cardinality.hpp"
+
+using ghost::global_constraints::GlobalCardinality;
+
+GlobalCardinality::GlobalCardinality( const std::vector<int>& variables_index,
+                                      const std::vector<int>& values,
+                                      const std::vector<int>& lower_bounds,
+                                      const std::vector<int>& upper_bounds )
+	: Constraint( variables_index ),
+	  _lower_bounds( lower_bounds ),
+	  _upper_bounds( upper_bounds ),
+	  _counts( values.size(), 0 )
+{
+	initialize_slots( values );
+}
+
+GlobalCardinality::GlobalCardinality( const std::vector<int>& variables_index,
+                                      const std::vector<int>& values,
+                                      const std::vector<int>& counts )
+	: GlobalCardinality( variables_index, values, counts, counts )
+{ }
+
+GlobalCardinality::GlobalCardinality( const std::vector<Variable>& variables,
+                                      const std::vector<int>& values,
+                                      const std::vector<int>& lower_bounds,
+                                      const std::vector<int>& upper_bounds )
+	: Constraint( variables ),
+	  _lower_bounds( lower_bounds ),
+	  _upper_bounds( upper_bounds ),
+	  _counts( values.size(), 0 )
+{
+	initialize_slots( values );
+}
+
+GlobalCardinality::GlobalCardinality( const std::vector<Variable>& variables,
+                                      const std::vector<int>& values,
+                                      const std::vector<int>& counts )
+	: GlobalCardinality( variables, values, counts, counts )
+{ }
+
+void GlobalCardinality::initialize_slots( const std::vector<int>& values )
+{
+	if( values.empty() )
+		return;
+
+	auto [ min, max ] = std::minmax_element( values.begin(), values.end() );
+	_min_value = *min;
+
+	// Dense slots as long as they do not take more than 64 times the memory of the sparse ones
+	if( static_cast<long>( *max ) - *min < 64 * static_cast<long>( values.size() ) )
+	{
+		_dense_slots.resize( *max - *min + 1, -1 );
+		for( int index = 0 ; index < static_cast<int>( values.size() ) ; ++index )
+			_dense_slots[ values[ index ] - _min_value ] = index;
+	}
+	else
+		for( int index = 0 ; index < static_cast<int>( values.size() ) ; ++index )
+			_sparse_slots[ values[ index ] ] = index;
+}
+
+double GlobalCardinality::required_error( const std::vector<Variable*>& variables ) const
+{
+	std::fill( _counts.begin(), _counts.end(), 0 );
+
+	for( auto variable : variables )
+	{
+		int value_slot = slot( variable->get_value() );
+		if( value_slot != -1 )
+			++_counts[ value_slot ];
+	}
+
+	double error = 0.0;
+	for( int value_slot = 0 ; value_slot < static_cast<int>( _counts.size() ) ; ++value_slot )
+		error += slot_error( value_slot, _counts[ value_slot ] );
+
+	return error;
+}
+
+double GlobalCardinality::optional_delta_error( const std::vector<Variable*>& variables,
+                                                const std::vector<int>& variable_indexes,
+                                                const std::vector<int>& candidate_values ) const
+{
+	double diff = 0.0;
+
+	// Change counts one variable after the other, then put them back.
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		diff += add_to_count( slot( variables[ variable_indexes[ i ] ]->get_value() ), -1 );
+		diff += add_to_count( slot( candidate_values[ i ] ), 1 );
+	}
+
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		add_to_count( slot( candidate_values[ i ] ), -1 );
+		add_to_count( slot( variables[ variable_indexes[ i ] ]->get_value() ), 1 );
+	}
+
+	return diff;
+}
+
+std::vector<double> GlobalCardinality::optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+                                                                       int variable_index,
+                                                                       const std::vector<int>& candidate_values ) const
+{
+	std::vector<double> deltas( candidate_values.size(), 0.0 );
+	int current_slot = slot( variables[ variable_index ]->get_value() );
+
+	// The variation due to removing the current value is the same for all candidates.
+	double removal = add_to_count( current_slot, -1 );
+
+	for( int i = 0 ; i < static_cast<int>( candidate_values.size() ) ; ++i )
+	{
+		int candidate_slot = slot( candidate_values[ i ] );
+		if( candidate_slot != -1 )
+			deltas[ i ] = slot_error( candidate_slot, _counts[ candidate_slot ] + 1 ) - slot_error( candidate_slot, _counts[ candidate_slot ] );
+		deltas[ i ] += removal;
+	}
+
+	add_to_count( current_slot, 1 );
+
+	return deltas;
+}
+
+std::vector<int> GlobalCardinality::optional_plausible_values( const std::vector<Variable*>& variables,
+                                                                int variable_index,
+                                                                const std::vector<int>& candidate_values ) const
+{
+	std::vector<int> plausible_values;
+	int current_slot = slot( variables[ variable_index ]->get_value() );
+
+	// Removing the current value decreases the error if it occurs too often, and increases it if it does not occur enough.
+	double removal = current_slot == -1 ? 0.0 : slot_error( current_slot, _counts[ current_slot ] - 1 ) - slot_error( current_slot, _counts[ current_slot ] );
+
+	if( removal < 0.0 )
+	{
+		// Any value not saturated yet
+		for( const int value : candidate_values )
+		{
+			int candidate_slot = slot( value );
+			if( candidate_slot == -1 || _counts[ candidate_slot ] < _upper_bounds[ candidate_slot ] )
+				plausible_values.push_back( value );
+		}
+	}
+	else if( removal == 0.0 )
+	{
+		// Values still below their lower bound only
+		for( const int value : candidate_values )
+		{
+			int candidate_slot = slot( value );
+			if( candidate_slot != -1 && _counts[ candidate_slot ] < _lower_bounds[ candidate_slot ] )
+				plausible_values.push_back( value );
+		}
+	}
+
+	return plausible_values;
+}
+
+void GlobalCardinality::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	add_to_count( slot( variables[ variable_index ]->get_value() ), -1 );
+	add_to_count( slot( new_value ), 1 );
+}
+
+// Only occurrences of values count
+bool GlobalCardinality::optional_is_permutation_invariant( const std::vector<Variable*>& variables ) const
+{
+	return true;
+}
+
+std::size_t GlobalCardinality::optional_memory_usage( const std::vector<Variable*>& variables ) const
+{
+	return MemoryUsage::heap_bytes( _lower_bounds )
+		+ MemoryUsage::heap_bytes( _upper_bounds )
+		+ MemoryUsage::heap_bytes( _dense_slots )
+		+ MemoryUsage::heap_bytes( _sparse_slots )
+		+ MemoryUsage::heap_bytes( _counts );
+}
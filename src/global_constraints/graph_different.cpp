@@ -0,0 +1,190 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+#include "global_constraints/graph_different.hpp"
+
+using ghost::global_constraints::GraphDifferent;
+using ghost::Constraint;
+
+GraphDifferent::GraphDifferent( const std::vector<int>& variables_index, const std::vector<std::pair<int,int>>& edges )
+	: Constraint( variables_index ),
+	  _min_color( 0 ),
+	  _number_colors( 0 )
+{
+	build_adjacency( static_cast<int>( variables_index.size() ), edges );
+}
+
+GraphDifferent::GraphDifferent( const std::vector<Variable>& variables, const std::vector<std::pair<int,int>>& edges )
+	: Constraint( variables ),
+	  _min_color( 0 ),
+	  _number_colors( 0 )
+{
+	build_adjacency( static_cast<int>( variables.size() ), edges );
+}
+
+void GraphDifferent::build_adjacency( int number_vertices, const std::vector<std::pair<int,int>>& edges )
+{
+	_offsets.resize( number_vertices + 1, 0 );
+
+	for( const auto& [ from, to ] : edges )
+		if( from != to )
+		{
+			++_offsets[ from + 1 ];
+			++_offsets[ to + 1 ];
+		}
+
+	for( int vertex = 0 ; vertex < number_vertices ; ++vertex )
+		_offsets[ vertex + 1 ] += _offsets[ vertex ];
+
+	_neighbors.resize( _offsets.back() );
+	std::vector<int> next( _offsets.begin(), _offsets.end() - 1 );
+
+	for( const auto& [ from, to ] : edges )
+		if( from != to )
+		{
+			_neighbors[ next[ from ]++ ] = to;
+			_neighbors[ next[ to ]++ ] = from;
+		}
+}
+
+double GraphDifferent::required_error( const std::vector<Variable*>& variables ) const
+{
+	// Domains never change: the color range only needs to be computed once.
+	if( _color_counts.empty() )
+	{
+		int max_color = std::numeric_limits<int>::min();
+		_min_color = std::numeric_limits<int>::max();
+
+		for( auto variable : variables )
+		{
+			_min_color = std::min( _min_color, variable->get_domain_min_value() );
+			max_color = std::max( max_color, variable->get_domain_max_value() );
+		}
+
+		_number_colors = max_color - _min_color + 1;
+		_color_counts.resize( variables.size() * _number_colors );
+	}
+
+	std::fill( _color_counts.begin(), _color_counts.end(), 0 );
+
+	int conflicts = 0;
+	for( int vertex = 0 ; vertex < static_cast<int>( variables.size() ) ; ++vertex )
+	{
+		for( int neighbor = _offsets[ vertex ] ; neighbor < _offsets[ vertex + 1 ] ; ++neighbor )
+			++color_count( vertex, variables[ _neighbors[ neighbor ] ]->get_value() );
+
+		conflicts += color_count( vertex, variables[ vertex ]->get_value() );
+	}
+
+	// Each conflicting edge has been counted twice
+	return conflicts / 2;
+}
+
+double GraphDifferent::optional_delta_error( const std::vector<Variable*>& variables,
+                                             const std::vector<int>& variable_indexes,
+                                             const std::vector<int>& candidate_values ) const
+{
+	if( variable_indexes.size() == 1 )
+	{
+		int vertex = variable_indexes[ 0 ];
+		return color_count( vertex, candidate_values[ 0 ] ) - color_count( vertex, variables[ vertex ]->get_value() );
+	}
+
+	// Recolor vertices one after the other, then put their colors back.
+	double diff = 0.0;
+
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		int vertex = variable_indexes[ i ];
+		int color = variables[ vertex ]->get_value();
+		diff += color_count( vertex, candidate_values[ i ] ) - color_count( vertex, color );
+		recolor( vertex, color, candidate_values[ i ] );
+	}
+
+	for( int i = static_cast<int>( variable_indexes.size() ) - 1 ; i >= 0 ; --i )
+		recolor( variable_indexes[ i ], candidate_values[ i ], variables[ variable_indexes[ i ] ]->get_value() );
+
+	return diff;
+}
+
+std::vector<double> GraphDifferent::optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+                                                                    int variable_index,
+                                                                    const std::vector<int>& candidate_values ) const
+{
+	std::vector<double> deltas( candidate_values.size() );
+	int current_conflicts = color_count( variable_index, variables[ variable_index ]->get_value() );
+
+	for( int i = 0 ; i < static_cast<int>( candidate_values.size() ) ; ++i )
+		deltas[ i ] = color_count( variable_index, candidate_values[ i ] ) - current_conflicts;
+
+	return deltas;
+}
+
+void GraphDifferent::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	recolor( variable_index, variables[ variable_index ]->get_value(), new_value );
+}
+
+bool GraphDifferent::optional_can_merge( const std::vector<Variable*>& variables, int index_1, int index_2 ) const
+{
+	// Adjacent vertices must have different colors
+	return std::find( _neighbors.begin() + _offsets[ index_1 ], _neighbors.begin() + _offsets[ index_1 + 1 ], index_2 ) == _neighbors.begin() + _offsets[ index_1 + 1 ];
+}
+
+std::shared_ptr<Constraint> GraphDifferent::optional_coarsen( const std::vector<Variable*>& variables,
+                                                              const std::vector<int>& coarse_variables_index ) const
+{
+	// Vertices of the coarse graph are the coarse variables. Parallel edges are kept,
+	// so that the coarse error is still the number of conflicting edges.
+	std::vector<int> coarse_scope;
+	std::vector<int> coarse_vertices( coarse_variables_index.size() );
+	std::map<int,int> positions;
+
+	for( int vertex = 0 ; vertex < static_cast<int>( coarse_variables_index.size() ) ; ++vertex )
+	{
+		auto [ iterator, is_new ] = positions.emplace( coarse_variables_index[ vertex ], static_cast<int>( coarse_scope.size() ) );
+		if( is_new )
+			coarse_scope.push_back( coarse_variables_index[ vertex ] );
+		coarse_vertices[ vertex ] = iterator->second;
+	}
+
+	std::vector<std::pair<int,int>> coarse_edges;
+	coarse_edges.reserve( _neighbors.size() / 2 );
+
+	for( int vertex = 0 ; vertex < static_cast<int>( coarse_variables_index.size() ) ; ++vertex )
+		for( int neighbor = _offsets[ vertex ] ; neighbor < _offsets[ vertex + 1 ] ; ++neighbor )
+			if( vertex < _neighbors[ neighbor ] )
+				coarse_edges.emplace_back( coarse_vertices[ vertex ], coarse_vertices[ _neighbors[ neighbor ] ] );
+
+	return std::make_shared<GraphDifferent>( coarse_scope, coarse_edges );
+}
@@ -30,10 +30,29 @@
 #include <cmath>
 #include <algorithm>
 #include <iostream>
+#include <map>
+#include <functional>
 
 #include "global_constraints/linear_equation.hpp"
 
 using ghost::global_constraints::LinearEquation;
+using ghost::Constraint;
+
+class LinearEquation::Coarse : public LinearEquation
+{
+	const LinearEquation* _finer_equation;
+
+	double compute_error( double sum ) const override
+	{
+		return _finer_equation->compute_error( sum );
+	}
+
+public:
+	Coarse( const std::vector<int>& variables_index, const std::vector<double>& coefficients, const LinearEquation* finer_equation )
+		: LinearEquation( variables_index, finer_equation->rhs, coefficients ),
+		  _finer_equation( finer_equation )
+	{ }
+};
 
 LinearEquation::LinearEquation( const std::vector<int>& variables_index, double rhs, const std::vector<double>& coefficients )
 	: Constraint( variables_index ),
@@ -68,7 +87,62 @@ double LinearEquation::optional_delta_error( const std::vector<Variable*>& varia
 	return compute_error( sum ) - get_current_error();
 } 
 
+std::vector<double> LinearEquation::optional_batch_error( const std::vector<Variable*>& variables,
+                                                         const std::vector<int>& values,
+                                                         int number_samples ) const
+{
+	std::vector<double> sums( number_samples, 0.0 );
+
+	// Variable by variable, to sum over contiguous values of all samples
+	for( size_t i = 0 ; i < variables.size() ; ++i )
+	{
+		const double coefficient = _coefficients[i];
+		const int* row = values.data() + i * number_samples;
+		for( int k = 0 ; k < number_samples ; ++k )
+			sums[k] += coefficient * row[k];
+	}
+
+	for( int k = 0 ; k < number_samples ; ++k )
+		sums[k] = compute_error( sums[k] );
+
+	return sums;
+}
+
 void LinearEquation::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value ) 
 {
 	_current_sum += _coefficients[ variable_index ] * ( new_value - variables[ variable_index ]->get_value() );
 }
+
+// Swapping values of variables with the same coefficient does not change the sum
+bool LinearEquation::optional_is_permutation_invariant( const std::vector<Variable*>& variables ) const
+{
+	return std::adjacent_find( _coefficients.begin(), _coefficients.end(), std::not_equal_to<double>() ) == _coefficients.end();
+}
+
+std::size_t LinearEquation::optional_memory_usage( const std::vector<Variable*>& variables ) const
+{
+	return MemoryUsage::heap_bytes( _coefficients );
+}
+
+std::shared_ptr<Constraint> LinearEquation::optional_coarsen( const std::vector<Variable*>& variables,
+                                                              const std::vector<int>& coarse_variables_index ) const
+{
+	// Merged variables take the same value: their coefficients are summed
+	std::vector<int> coarse_scope;
+	std::vector<double> coarse_coefficients;
+	std::map<int,int> positions;
+
+	for( size_t i = 0 ; i < coarse_variables_index.size() ; ++i )
+	{
+		auto [ iterator, is_new ] = positions.emplace( coarse_variables_index[i], static_cast<int>( coarse_scope.size() ) );
+		if( is_new )
+		{
+			coarse_scope.push_back( coarse_variables_index[i] );
+			coarse_coefficients.push_back( _coefficients[i] );
+		}
+		else
+			coarse_coefficients[ iterator->second ] += _coefficients[i];
+	}
+
+	return std::make_shared<Coarse>( coarse_scope, coarse_coefficients, this );
+}
@@ -0,0 +1,217 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+
+#include "global_constraints/regular.hpp"
+
+using ghost::global_constraints::Regular;
+
+Regular::Regular( const std::vector<int>& variables_index,
+                  int number_states,
+                  int initial_state,
+                  const std::vector<int>& accepting_states,
+                  const std::vector<std::tuple<int,int,int>>& transitions )
+	: Constraint( variables_index ),
+	  _number_states( number_states ),
+	  _initial_state( initial_state ),
+	  _transitions( transitions ),
+	  _word( variables_index.size(), 0 )
+{
+	initialize( accepting_states );
+}
+
+Regular::Regular( const std::vector<Variable>& variables,
+                  int number_states,
+                  int initial_state,
+                  const std::vector<int>& accepting_states,
+                  const std::vector<std::tuple<int,int,int>>& transitions )
+	: Constraint( variables ),
+	  _number_states( number_states ),
+	  _initial_state( initial_state ),
+	  _transitions( transitions ),
+	  _word( variables.size(), 0 )
+{
+	initialize( accepting_states );
+}
+
+void Regular::initialize( const std::vector<int>& accepting_states )
+{
+	int length = static_cast<int>( _word.size() );
+
+	_accepting_states.resize( _number_states, false );
+	for( int state : accepting_states )
+		_accepting_states[ state ] = true;
+
+	for( const auto& [ from, symbol, to ] : _transitions )
+		_transitions_by_symbol[ symbol ].emplace_back( from, to );
+
+	_forward.resize( ( length + 1 ) * _number_states, UNREACHABLE );
+	_backward.resize( ( length + 1 ) * _number_states, UNREACHABLE );
+	_change_costs.resize( length, -1 );
+
+	forward_row( 0 )[ _initial_state ] = 0;
+	for( int state = 0 ; state < _number_states ; ++state )
+		if( _accepting_states[ state ] )
+			backward_row( length )[ state ] = 0;
+
+	_forward_valid_up_to = 0;
+	_backward_valid_from = length;
+}
+
+void Regular::forward_step( const int* row, int symbol, int* next_row ) const
+{
+	std::fill( next_row, next_row + _number_states, UNREACHABLE );
+
+	for( const auto& [ from, transition_symbol, to ] : _transitions )
+		if( row[ from ] < UNREACHABLE )
+			next_row[ to ] = std::min( next_row[ to ], row[ from ] + ( transition_symbol != symbol ? 1 : 0 ) );
+}
+
+void Regular::backward_step( const int* next_row, int symbol, int* row ) const
+{
+	std::fill( row, row + _number_states, UNREACHABLE );
+
+	for( const auto& [ from, transition_symbol, to ] : _transitions )
+		if( next_row[ to ] < UNREACHABLE )
+			row[ from ] = std::min( row[ from ], next_row[ to ] + ( transition_symbol != symbol ? 1 : 0 ) );
+}
+
+void Regular::compute_forward_up_to( int position ) const
+{
+	for( ; _forward_valid_up_to < position ; ++_forward_valid_up_to )
+		forward_step( forward_row( _forward_valid_up_to ), _word[ _forward_valid_up_to ], forward_row( _forward_valid_up_to + 1 ) );
+}
+
+void Regular::compute_backward_down_to( int position ) const
+{
+	for( ; _backward_valid_from > position ; --_backward_valid_from )
+		backward_step( backward_row( _backward_valid_from ), _word[ _backward_valid_from - 1 ], backward_row( _backward_valid_from - 1 ) );
+}
+
+int Regular::cost_with( int position, int symbol ) const
+{
+	compute_forward_up_to( position );
+	compute_backward_down_to( position + 1 );
+
+	const int* row = forward_row( position );
+	const int* next_row = backward_row( position + 1 );
+
+	if( _change_costs[ position ] == -1 )
+	{
+		int cost = UNREACHABLE;
+		for( const auto& [ from, transition_symbol, to ] : _transitions )
+			cost = std::min( cost, row[ from ] + next_row[ to ] + 1 );
+		_change_costs[ position ] = std::min( cost, UNREACHABLE );
+	}
+
+	int cost = _change_costs[ position ];
+
+	auto iterator = _transitions_by_symbol.find( symbol );
+	if( iterator != _transitions_by_symbol.end() )
+		for( const auto& [ from, to ] : iterator->second )
+			cost = std::min( cost, row[ from ] + next_row[ to ] );
+
+	return cost;
+}
+
+double Regular::to_error( int cost ) const
+{
+	return static_cast<double>( std::min( cost, static_cast<int>( _word.size() ) + 1 ) );
+}
+
+double Regular::required_error( const std::vector<Variable*>& variables ) const
+{
+	for( int position = 0 ; position < static_cast<int>( variables.size() ) ; ++position )
+		_word[ position ] = variables[ position ]->get_value();
+
+	_forward_valid_up_to = 0;
+	_backward_valid_from = static_cast<int>( _word.size() );
+	std::fill( _change_costs.begin(), _change_costs.end(), -1 );
+
+	compute_backward_down_to( 0 );
+	return to_error( backward_row( 0 )[ _initial_state ] );
+}
+
+double Regular::optional_delta_error( const std::vector<Variable*>& variables,
+                                      const std::vector<int>& variable_indexes,
+                                      const std::vector<int>& candidate_values ) const
+{
+	if( variable_indexes.size() == 1 )
+		return to_error( cost_with( variable_indexes[ 0 ], candidate_values[ 0 ] ) ) - get_current_error();
+
+	// Replay the automaton between the first and the last changed positions only.
+	auto [ first, last ] = std::minmax_element( variable_indexes.begin(), variable_indexes.end() );
+	int begin = *first;
+	int end = *last + 1;
+
+	compute_forward_up_to( begin );
+	compute_backward_down_to( end );
+
+	std::vector<int> symbols( _word.begin() + begin, _word.begin() + end );
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+		symbols[ variable_indexes[ i ] - begin ] = candidate_values[ i ];
+
+	std::vector<int> row( forward_row( begin ), forward_row( begin ) + _number_states );
+	std::vector<int> next_row( _number_states );
+	for( int symbol : symbols )
+	{
+		forward_step( row.data(), symbol, next_row.data() );
+		row.swap( next_row );
+	}
+
+	const int* accepting_row = backward_row( end );
+	int cost = UNREACHABLE;
+	for( int state = 0 ; state < _number_states ; ++state )
+		cost = std::min( cost, row[ state ] + accepting_row[ state ] );
+
+	return to_error( cost ) - get_current_error();
+}
+
+std::vector<double> Regular::optional_delta_error_on_domain( const std::vector<Variable*>& variables,
+                                                             int variable_index,
+                                                             const std::vector<int>& candidate_values ) const
+{
+	std::vector<double> deltas( candidate_values.size() );
+
+	for( int i = 0 ; i < static_cast<int>( candidate_values.size() ) ; ++i )
+		deltas[ i ] = to_error( cost_with( variable_index, candidate_values[ i ] ) ) - get_current_error();
+
+	return deltas;
+}
+
+void Regular::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	_word[ variable_index ] = new_value;
+
+	// Forward rows up to the changed position and backward rows after it are still valid.
+	_forward_valid_up_to = std::min( _forward_valid_up_to, variable_index );
+	_backward_valid_from = std::max( _backward_valid_from, variable_index + 1 );
+	std::fill( _change_costs.begin(), _change_costs.end(), -1 );
+}
@@ -0,0 +1,114 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+
+#include "global_objectives/max_counter.hpp"
+
+using ghost::global_objectives::MaxCounter;
+
+MaxCounter::MaxCounter()
+	: _min_value( 0 ),
+	  _max( -1 ),
+	  _below_max( -1 ),
+	  _below_max_outdated( true )
+{ }
+
+int MaxCounter::greatest_from( int index ) const
+{
+	while( index >= 0 && _counts[ index ] == 0 )
+		--index;
+
+	return index;
+}
+
+void MaxCounter::reset( int min_value, int max_value )
+{
+	_min_value = min_value;
+	_counts.assign( std::max( 1, max_value - min_value + 1 ), 0 );
+	_max = -1;
+	_below_max_outdated = true;
+}
+
+void MaxCounter::add( int value )
+{
+	int index = value - _min_value;
+	++_counts[ index ];
+	_max = std::max( _max, index );
+	_below_max_outdated = true;
+}
+
+void MaxCounter::remove( int value )
+{
+	int index = value - _min_value;
+	--_counts[ index ];
+	if( index == _max && _counts[ index ] == 0 )
+		_max = greatest_from( index - 1 );
+	_below_max_outdated = true;
+}
+
+int MaxCounter::max_after_change( int old_value, int new_value ) const
+{
+	int old_index = old_value - _min_value;
+	int new_index = new_value - _min_value;
+
+	if( new_index >= _max )
+		return new_value;
+
+	if( old_index != _max || _counts[ _max ] > 1 )
+		return max();
+
+	// The only occurrence of the maximal value is replaced by a lower value
+	if( _below_max_outdated )
+	{
+		_below_max = greatest_from( _max - 1 );
+		_below_max_outdated = false;
+	}
+
+	return std::max( new_index, _below_max ) + _min_value;
+}
+
+int MaxCounter::max_after_changes( const std::vector<int>& old_values, const std::vector<int>& new_values )
+{
+	for( int i = 0 ; i < static_cast<int>( old_values.size() ) ; ++i )
+	{
+		remove( old_values[ i ] );
+		add( new_values[ i ] );
+	}
+
+	int result = max();
+
+	for( int i = static_cast<int>( old_values.size() ) - 1 ; i >= 0 ; --i )
+	{
+		remove( new_values[ i ] );
+		add( old_values[ i ] );
+	}
+
+	return result;
+}
@@ -0,0 +1,108 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "global_objectives/maximize_min.hpp"
+
+using ghost::global_objectives::MaximizeMin;
+
+namespace
+{
+	inline int term( const std::vector<int>& offsets, int index, int value )
+	{
+		return -( value + offsets[ index ] );
+	}
+}
+
+MaximizeMin::MaximizeMin( const std::vector<int>& variables_index )
+	: Maximize( variables_index, "MaximizeMin" ),
+	  _offsets( variables_index.size(), 0 )
+{ }
+
+MaximizeMin::MaximizeMin( const std::vector<int>& variables_index, const std::vector<int>& offsets )
+	: Maximize( variables_index, "MaximizeMin" ),
+	  _offsets( offsets )
+{ }
+
+MaximizeMin::MaximizeMin( const std::vector<Variable>& variables )
+	: Maximize( variables, "MaximizeMin" ),
+	  _offsets( variables.size(), 0 )
+{ }
+
+MaximizeMin::MaximizeMin( const std::vector<Variable>& variables, const std::vector<int>& offsets )
+	: Maximize( variables, "MaximizeMin" ),
+	  _offsets( offsets )
+{ }
+
+double MaximizeMin::required_cost( const std::vector<Variable*>& variables ) const
+{
+	int min_term = std::numeric_limits<int>::max();
+	int max_term = std::numeric_limits<int>::min();
+
+	for( int index = 0 ; index < static_cast<int>( variables.size() ) ; ++index )
+	{
+		min_term = std::min( min_term, -( variables[ index ]->get_domain_max_value() + _offsets[ index ] ) );
+		max_term = std::max( max_term, -( variables[ index ]->get_domain_min_value() + _offsets[ index ] ) );
+	}
+
+	_counter.reset( min_term, max_term );
+	for( int index = 0 ; index < static_cast<int>( variables.size() ) ; ++index )
+		_counter.add( term( _offsets, index, variables[ index ]->get_value() ) );
+
+	return -_counter.max();
+}
+
+double MaximizeMin::optional_delta_cost( const std::vector<Variable*>& variables,
+                                         const std::vector<int>& variable_indexes,
+                                         const std::vector<int>& candidate_values ) const
+{
+	if( variable_indexes.size() == 1 )
+	{
+		int variable = variable_indexes[ 0 ];
+		return -_counter.max_after_change( term( _offsets, variable, variables[ variable ]->get_value() ), term( _offsets, variable, candidate_values[ 0 ] ) ) + _counter.max();
+	}
+
+	std::vector<int> old_terms( variable_indexes.size() );
+	std::vector<int> new_terms( variable_indexes.size() );
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		old_terms[ i ] = term( _offsets, variable_indexes[ i ], variables[ variable_indexes[ i ] ]->get_value() );
+		new_terms[ i ] = term( _offsets, variable_indexes[ i ], candidate_values[ i ] );
+	}
+
+	return -_counter.max_after_changes( old_terms, new_terms ) + _counter.max();
+}
+
+void MaximizeMin::conditional_update_data_structures( const std::vector<Variable*>& variables, int index, int new_value )
+{
+	_counter.remove( term( _offsets, index, variables[ index ]->get_value() ) );
+	_counter.add( term( _offsets, index, new_value ) );
+}
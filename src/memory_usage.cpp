@@ -0,0 +1,70 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EFSP/EFOP. 
+ *
+ * First developped to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2022 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <numeric>
+
+#include "memory_usage.hpp"
+
+using ghost::MemoryUsage;
+
+void MemoryUsage::add( const std::string& structure, std::size_t bytes )
+{
+	if( bytes > 0 )
+		_breakdown[ structure ] += bytes;
+}
+
+void MemoryUsage::add( const std::string& prefix, const MemoryUsage& other )
+{
+	for( const auto& [ structure, bytes ] : other._breakdown )
+		add( prefix + " / " + structure, bytes );
+}
+
+std::size_t MemoryUsage::get( const std::string& structure ) const
+{
+	auto iterator = _breakdown.find( structure );
+	return iterator == _breakdown.end() ? 0 : iterator->second;
+}
+
+std::size_t MemoryUsage::total() const
+{
+	return std::accumulate( _breakdown.begin(),
+	                        _breakdown.end(),
+	                        std::size_t( 0 ),
+	                        []( std::size_t sum, const auto& structure ){ return sum + structure.second; } );
+}
+
+std::size_t MemoryUsage::heap_bytes( const std::string& string )
+{
+	// Short strings are stored in the string object itself
+	const char* object = reinterpret_cast<const char*>( &string );
+	if( !std::less<const char*>()( string.data(), object ) && std::less<const char*>()( string.data(), object + sizeof( std::string ) ) )
+		return 0;
+
+	return string.capacity() + 1;
+}
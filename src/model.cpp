@@ -30,6 +30,7 @@
 #include "model.hpp"
 
 using ghost::Model;
+using ghost::MemoryUsage;
 
 Model::Model( std::vector<Variable>&& moved_variables,
               const std::vector<std::shared_ptr<Constraint>>&	constraints,
@@ -42,3 +43,40 @@ Model::Model( std::vector<Variable>&& moved_variables,
 	  auxiliary_data( auxiliary_data ),
 	  permutation_problem( permutation_problem )
 { }
+
+MemoryUsage Model::memory_usage() const
+{
+	MemoryUsage usage;
+
+	usage.add( "variables", MemoryUsage::heap_bytes( variables ) );
+	for( const auto& variable : variables )
+	{
+		usage.add( "domains", MemoryUsage::heap_bytes( variable._domain ) );
+		usage.add( "variable names", MemoryUsage::heap_bytes( variable._name ) );
+	}
+
+	// Members of derived constraint classes are reported by optional_memory_usage
+	usage.add( "constraints", MemoryUsage::heap_bytes( constraints ) + constraints.size() * sizeof( Constraint ) );
+	for( const auto& constraint : constraints )
+	{
+		usage.add( "constraint scopes", MemoryUsage::heap_bytes( constraint->_variables )
+		                                + MemoryUsage::heap_bytes( constraint->_variables_index )
+		                                + MemoryUsage::heap_bytes( constraint->_variables_position ) );
+		usage.add( "constraint states", constraint->optional_memory_usage( constraint->_variables ) );
+	}
+
+	if( objective )
+		usage.add( "objective function", sizeof( Objective )
+		                                  + MemoryUsage::heap_bytes( objective->_variables )
+		                                  + MemoryUsage::heap_bytes( objective->_variables_index )
+		                                  + MemoryUsage::heap_bytes( objective->_variables_position )
+		                                  + MemoryUsage::heap_bytes( objective->_name ) );
+
+	if( auxiliary_data )
+		usage.add( "auxiliary data", sizeof( AuxiliaryData )
+		                             + MemoryUsage::heap_bytes( auxiliary_data->_variables )
+		                             + MemoryUsage::heap_bytes( auxiliary_data->_variables_index )
+		                             + MemoryUsage::heap_bytes( auxiliary_data->_variables_position ) );
+
+	return usage;
+}
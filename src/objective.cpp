@@ -35,6 +35,7 @@ Objective::Objective( const std::vector<int>& variables_index, bool is_maximizat
 	: _variables_index( variables_index ),
 	  _is_optimization( true ),
 	  _is_maximization( is_maximization ),
+	  _is_optional_delta_cost_defined( true ),
 	  _name( name )
 { }
 
@@ -42,6 +43,7 @@ Objective::Objective( const std::vector<Variable>& variables, bool is_maximizati
 	: _variables_index( std::vector<int>( variables.size() ) ),
 	  _is_optimization( true ),
 	  _is_maximization( is_maximization ),
+	  _is_optional_delta_cost_defined( true ),
 	  _name( name )
 {
 	std::transform( variables.begin(),
@@ -63,6 +65,43 @@ double Objective::cost() const
 	return value;
 }
 
+double Objective::delta_cost( const std::vector<int>& variables_index, const std::vector<int>& candidate_values ) const
+{
+	std::vector<int> variables_index_within_objective;
+	std::vector<int> candidate_values_within_objective;
+
+	for( int i = 0 ; i < static_cast<int>( variables_index.size() ) ; ++i )
+	{
+		auto iterator = _variables_position.find( variables_index[ i ] );
+		if( iterator != _variables_position.end() )
+		{
+			variables_index_within_objective.push_back( iterator->second );
+			candidate_values_within_objective.push_back( candidate_values[ i ] );
+		}
+	}
+
+	if( variables_index_within_objective.empty() )
+		return 0.0;
+
+	double value = optional_delta_cost( _variables, variables_index_within_objective, candidate_values_within_objective );
+
+	if( std::isnan( value ) )
+		throw nanException( _variables );
+
+	if( _is_maximization )
+		value *= -1;
+
+	return value;
+}
+
+double Objective::optional_delta_cost( const std::vector<Variable*>& variables,
+                                       const std::vector<int>& variable_indexes,
+                                       const std::vector<int>& candidate_values ) const
+{
+	_is_optional_delta_cost_defined = false;
+	throw deltaCostNotDefinedException();
+}
+
 void Objective::conditional_update_data_structures( const std::vector<Variable*>& variables, int index, int new_value )
 { }
 
@@ -80,8 +119,13 @@ int Objective::expert_heuristic_value( const std::vector<Variable*>& variables,
 
 	for( auto v : possible_values )
 	{
-		var->set_value( v );
-		simulated_cost = required_cost( variables );
+		if( _is_optional_delta_cost_defined )
+			simulated_cost = optional_delta_cost( variables, std::vector<int>{ variable_index }, std::vector<int>{ v } );
+		else
+		{
+			var->set_value( v );
+			simulated_cost = required_cost( variables );
+		}
 
 		if( _is_maximization )
 			simulated_cost *= -1;
@@ -28,6 +28,7 @@
  */
 
 #include <thread>
+#include <limits>
 
 #include "options.hpp"
 
@@ -45,7 +46,18 @@ Options::Options()
 	  reset_threshold( -1 ),
 	  restart_threshold( -1 ),
 	  number_variables_to_reset( -1 ),
-	  number_start_samplings( -1 )
+	  number_start_samplings( -1 ),
+	  target_cost( std::numeric_limits<double>::quiet_NaN() ),
+	  stagnation_iterations( -1 ),
+	  stagnation_percent_budget( -1 ),
+	  neighborhoods(),
+	  multilevel( false ),
+	  multilevel_coarsest_size( -1 ),
+	  multilevel_percent_budget( -1 ),
+	  configuration_checking( false ),
+	  exhaustive_search_threshold( -1 ),
+	  intensification_percent_budget( -1 ),
+	  intensification_top_k( -1 )
 { }
 
 Options::Options( const Options& other )
@@ -60,7 +72,18 @@ Options::Options( const Options& other )
 	  reset_threshold( other.reset_threshold ),
 	  restart_threshold( other.restart_threshold ),
 	  number_variables_to_reset( other.number_variables_to_reset ),
-	  number_start_samplings( other.number_start_samplings )
+	  number_start_samplings( other.number_start_samplings ),
+	  target_cost( other.target_cost ),
+	  stagnation_iterations( other.stagnation_iterations ),
+	  stagnation_percent_budget( other.stagnation_percent_budget ),
+	  neighborhoods( other.neighborhoods ),
+	  multilevel( other.multilevel ),
+	  multilevel_coarsest_size( other.multilevel_coarsest_size ),
+	  multilevel_percent_budget( other.multilevel_percent_budget ),
+	  configuration_checking( other.configuration_checking ),
+	  exhaustive_search_threshold( other.exhaustive_search_threshold ),
+	  intensification_percent_budget( other.intensification_percent_budget ),
+	  intensification_top_k( other.intensification_top_k )
 { }
 
 Options::Options( Options&& other )
@@ -75,7 +98,18 @@ Options::Options( Options&& other )
 	  reset_threshold( other.reset_threshold ),
 	  restart_threshold( other.restart_threshold ),
 	  number_variables_to_reset( other.number_variables_to_reset ),
-	  number_start_samplings( other.number_start_samplings )
+	  number_start_samplings( other.number_start_samplings ),
+	  target_cost( other.target_cost ),
+	  stagnation_iterations( other.stagnation_iterations ),
+	  stagnation_percent_budget( other.stagnation_percent_budget ),
+	  neighborhoods( std::move( other.neighborhoods ) ),
+	  multilevel( other.multilevel ),
+	  multilevel_coarsest_size( other.multilevel_coarsest_size ),
+	  multilevel_percent_budget( other.multilevel_percent_budget ),
+	  configuration_checking( other.configuration_checking ),
+	  exhaustive_search_threshold( other.exhaustive_search_threshold ),
+	  intensification_percent_budget( other.intensification_percent_budget ),
+	  intensification_top_k( other.intensification_top_k )
 {	}
 
 Options& Options::operator=( Options other )
@@ -94,6 +128,17 @@ Options& Options::operator=( Options other )
 		restart_threshold = other.restart_threshold;
 		number_variables_to_reset = other.number_variables_to_reset;
 		number_start_samplings = other.number_start_samplings;
+		target_cost = other.target_cost;
+		stagnation_iterations = other.stagnation_iterations;
+		stagnation_percent_budget = other.stagnation_percent_budget;
+		std::swap( neighborhoods, other.neighborhoods );
+		multilevel = other.multilevel;
+		multilevel_coarsest_size = other.multilevel_coarsest_size;
+		multilevel_percent_budget = other.multilevel_percent_budget;
+		configuration_checking = other.configuration_checking;
+		exhaustive_search_threshold = other.exhaustive_search_threshold;
+		intensification_percent_budget = other.intensification_percent_budget;
+		intensification_top_k = other.intensification_top_k;
 	}
 
 	return *this;
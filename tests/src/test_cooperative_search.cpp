@@ -0,0 +1,140 @@
+#include <ghost/solver.hpp>
+#include <ghost/global_constraints/all_different.hpp>
+#include <ghost/global_objectives/maximize_min.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+// This file must be compiled with C++20: it fails to compile if ghost::cooperative_search is not available.
+
+using namespace std::literals::chrono_literals;
+
+class PermutationBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 12, 0, 12 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+	}
+};
+
+class SpreadBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 4, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+	}
+
+	void declare_objective() override
+	{
+		objective = std::make_shared<ghost::global_objectives::MaximizeMin>( variables );
+	}
+};
+
+class Failing : public ghost::Constraint
+{
+	double required_error( const std::vector<ghost::Variable*>& ) const override
+	{
+		throw std::runtime_error( "required_error failed" );
+	}
+
+public:
+	Failing( const std::vector<ghost::Variable>& variables )
+		: Constraint( variables )
+	{ }
+};
+
+class FailingBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 4, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<Failing>( variables ) );
+	}
+};
+
+TEST(CooperativeSearchTest, SatisfactionUntilDone)
+{
+	PermutationBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+
+	auto task = ghost::cooperative_search( solver, options );
+	EXPECT_FALSE( task.done() );
+
+	// The search starts with the first time slice, and the task is done once a solution is found
+	int slices = 0;
+	while( task.resume( 1ms ) && slices < 10000 )
+		++slices;
+
+	EXPECT_TRUE( task.done() );
+	EXPECT_FALSE( task.resume( 1ms ) );
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.end( cost, solution ) );
+	EXPECT_EQ( cost, 0.0 );
+	std::sort( solution.begin(), solution.end() );
+	EXPECT_EQ( std::adjacent_find( solution.begin(), solution.end() ), solution.end() );
+}
+
+TEST(CooperativeSearchTest, OptimizationStoppedByCaller)
+{
+	SpreadBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+
+	auto task = ghost::cooperative_search( solver, options );
+
+	double cost;
+	std::vector<int> solution;
+	// Optimization problems run until the caller stops giving time slices
+	for( int slice = 0 ; slice < 200 ; ++slice )
+	{
+		EXPECT_TRUE( task.resume( 500us ) );
+		// best candidate so far is available between two slices
+		if( solver.best( cost, solution ) )
+		{
+			EXPECT_EQ( cost, *std::min_element( solution.begin(), solution.end() ) );
+		}
+	}
+	EXPECT_FALSE( task.done() );
+
+	EXPECT_TRUE( solver.end( cost, solution ) );
+	EXPECT_EQ( cost, 6.0 );
+}
+
+TEST(CooperativeSearchTest, ExceptionRethrownByResume)
+{
+	FailingBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+
+	auto task = ghost::cooperative_search( solver, options );
+	EXPECT_THROW( task.resume( 1ms ), std::runtime_error );
+	EXPECT_TRUE( task.done() );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,202 @@
+#include <ghost/solver.hpp>
+#include <ghost/expressions/expression_constraint.hpp>
+#include <ghost/expressions/minimize_expression.hpp>
+#include <ghost/expressions/maximize_expression.hpp>
+#include <ghost/expressions/expression_network.hpp>
+#include <ghost/expressions/expression_templates.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+
+using namespace std::literals::chrono_literals;
+using namespace ghost::expressions;
+
+class DistinctSumBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 3, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		Expression a( variables[0] ), b( variables[1] ), c( variables[2] );
+		constraints.emplace_back( std::make_shared<ExpressionConstraint>( not_equal( a, b ) + not_equal( a, c ) + not_equal( b, c ) ) );
+		constraints.emplace_back( std::make_shared<ExpressionConstraint>( equal( a + b, c ) ) );
+	}
+
+	void declare_objective() override
+	{
+		objective = std::make_shared<MinimizeExpression>( maximum( { variables[0], variables[1], variables[2] } ) );
+	}
+};
+
+class BudgetBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 2, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		Expression x( variables[0] ), y( variables[1] );
+		constraints.emplace_back( std::make_shared<ExpressionConstraint>( less_equal( x + y, 6 ) ) );
+		constraints.emplace_back( std::make_shared<ExpressionConstraint>( less_equal( x - y, 2 ) ) );
+	}
+
+	void declare_objective() override
+	{
+		objective = std::make_shared<MaximizeExpression>( 3 * Expression( variables[0] ) + 2 * Expression( variables[1] ) );
+	}
+};
+
+class CompiledBudgetBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 2, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		auto x = ghost::expr::vars( variables );
+		constraints.emplace_back( ghost::expr::make_constraint( ghost::expr::sum( x ) <= 6 ) );
+		constraints.emplace_back( ghost::expr::make_constraint( ghost::expr::sum( ghost::expr::coefficients( { 1, -1 } ) * x ) <= 2 ) );
+	}
+
+	void declare_objective() override
+	{
+		objective = std::make_shared<MaximizeExpression>( 3 * Expression( variables[0] ) + 2 * Expression( variables[1] ) );
+	}
+};
+
+TEST(ExpressionsTest, MinimizeExpression)
+{
+	DistinctSumBuilder builder;
+	ghost::Solver solver( builder );
+	// Solved by local search, not by enumerating the small search space
+	ghost::Options options;
+	options.exhaustive_search_threshold = 0;
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 100ms, options ) );
+	EXPECT_EQ( cost, 3.0 );
+	EXPECT_EQ( solution[0] + solution[1], solution[2] );
+}
+
+TEST(ExpressionsTest, MaximizeExpression)
+{
+	BudgetBuilder builder;
+	ghost::Solver solver( builder );
+	// Solved by local search, not by enumerating the small search space
+	ghost::Options options;
+	options.exhaustive_search_threshold = 0;
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 100ms, options ) );
+	EXPECT_EQ( cost, 16.0 );
+	EXPECT_EQ( solution[0], 4 );
+	EXPECT_EQ( solution[1], 2 );
+}
+
+TEST(ExpressionsTest, CompiledConstraint)
+{
+	CompiledBudgetBuilder builder;
+	ghost::Solver solver( builder );
+	// Solved by local search, not by enumerating the small search space
+	ghost::Options options;
+	options.exhaustive_search_threshold = 0;
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 100ms, options ) );
+	EXPECT_EQ( cost, 16.0 );
+	EXPECT_EQ( solution[0], 4 );
+	EXPECT_EQ( solution[1], 2 );
+}
+
+TEST(ExpressionsTest, CompiledConstraintScope)
+{
+	auto x = ghost::expr::vars( std::vector<int>{ 0, 1, 2 } );
+	auto y = ghost::expr::vars( std::vector<int>{ 3, 4, 5 } );
+
+	EXPECT_THROW( ghost::expr::sum( ghost::expr::coefficients( { 1, 2 } ) * x ), ghost::expr::expressionException );
+	EXPECT_THROW( ghost::expr::sum( x ) + ghost::expr::sum( y ), ghost::expr::expressionException );
+	EXPECT_NO_THROW( ghost::expr::make_constraint( 4 >= ghost::expr::sum( 2 * x + 1 ) + ghost::expr::sum( x * x ) ) );
+}
+
+TEST(ExpressionsTest, NetworkIncrementalUpdates)
+{
+	// Sum, Count, Min/Max, Product and Element nodes, s and c being shared by several parents
+	std::vector<Expression> x;
+	for( int id = 0 ; id < 5 ; ++id )
+		x.push_back( variable( id ) );
+
+	Expression s = sum( { x[0], x[1], x[2] } );
+	Expression c = count( { x[0], x[1], x[3], x[4] }, 2 );
+	Expression m = minimum( { s, x[3], 3 * x[4] } );
+	Expression M = maximum( { s, c, x[2] } );
+	Expression p = product( { x[1] + 1, c, x[4] - 2 } );
+	Expression e = element( x[2], { 4, -1, 7, 0, 2, 5 } );
+	Expression f = element( s - c, { 1, 3, 0, 8 } );
+	Expression root = sum( { m, M, p, e, f, s, c }, { 1, -2, 1, 3, 1, 0.5, 2 } ) + not_equal( M, x[3] );
+
+	ExpressionNetwork network( root );
+	ExpressionNetwork reference( root );
+	ASSERT_EQ( network.get_variable_ids(), ( std::vector<int>{ 0, 1, 2, 3, 4 } ) );
+
+	std::vector<ghost::Variable> variables;
+	for( int id = 0 ; id < 5 ; ++id )
+		variables.emplace_back( 0, 6 );
+	std::vector<ghost::Variable*> pointers;
+	for( auto& var : variables )
+		pointers.push_back( &var );
+
+	std::mt19937 rng( 42 );
+	std::uniform_int_distribution<int> position_distribution( 0, 4 );
+	std::uniform_int_distribution<int> value_distribution( 0, 5 );
+
+	double value = network.evaluate( pointers );
+	EXPECT_DOUBLE_EQ( value, reference.evaluate( pointers ) );
+
+	for( int step = 0 ; step < 1000 ; ++step )
+	{
+		int position = position_distribution( rng );
+		int new_value = value_distribution( rng );
+		int other_position = ( position + 1 + position_distribution( rng ) % 4 ) % 5;
+		int other_value = value_distribution( rng );
+
+		// Simulating a move leaves the network unchanged
+		int old_value = variables[ position ].get_value();
+		int old_other_value = variables[ other_position ].get_value();
+		variables[ position ].set_value( new_value );
+		variables[ other_position ].set_value( other_value );
+		double expected = reference.evaluate( pointers );
+		variables[ position ].set_value( old_value );
+		variables[ other_position ].set_value( old_other_value );
+
+		EXPECT_DOUBLE_EQ( network.simulate( { position, other_position }, { new_value, other_value } ) - network.get_value(), expected - value );
+		EXPECT_DOUBLE_EQ( network.get_value(), value );
+
+		variables[ position ].set_value( new_value );
+		expected = reference.evaluate( pointers );
+		EXPECT_DOUBLE_EQ( network.simulate( { position }, { new_value } ) - network.get_value(), expected - value );
+
+		network.update( position, new_value );
+		value = network.get_value();
+		EXPECT_DOUBLE_EQ( value, expected );
+	}
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,579 @@
+#include <ghost/solver.hpp>
+#include <ghost/global_constraints/all_different.hpp>
+#include <ghost/global_constraints/at_least.hpp>
+#include <ghost/global_constraints/at_most.hpp>
+#include <ghost/global_constraints/bin_packing.hpp>
+#include <ghost/global_constraints/circuit.hpp>
+#include <ghost/global_constraints/count.hpp>
+#include <ghost/global_constraints/cumulative.hpp>
+#include <ghost/global_constraints/element.hpp>
+#include <ghost/global_constraints/element_2d.hpp>
+#include <ghost/global_constraints/fix_value.hpp>
+#include <ghost/global_constraints/global_cardinality.hpp>
+#include <ghost/global_constraints/graph_different.hpp>
+#include <ghost/global_constraints/linear_equation_eq.hpp>
+#include <ghost/global_constraints/regular.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+using namespace std::literals::chrono_literals;
+
+namespace ghost
+{
+	// Check the incremental methods of the constraints of a model, i.e., optional_delta_error,
+	// optional_delta_error_on_domain and conditional_update_data_structures, against required_error
+	// along random moves. Moves are applied the way SearchUnit does, and constraints under test are
+	// never evaluated from scratch after initialization, so that stale data structures show up.
+	// A second model built from the same builder computes reference errors.
+	class ConstraintChecker
+	{
+		Model _model;
+		Model _reference;
+		std::mt19937 _rng;
+
+		int random_variable()
+		{
+			return std::uniform_int_distribution<int>( 0, static_cast<int>( _model.variables.size() ) - 1 )( _rng );
+		}
+
+		int random_value( int variable_id )
+		{
+			const auto& domain = _model.variables[ variable_id ].get_full_domain();
+			return domain[ std::uniform_int_distribution<int>( 0, static_cast<int>( domain.size() ) - 1 )( _rng ) ];
+		}
+
+		bool in_domain( int variable_id, int value ) const
+		{
+			const auto& domain = _model.variables[ variable_id ].get_full_domain();
+			return std::find( domain.begin(), domain.end(), value ) != domain.end();
+		}
+
+		// Reference error of a constraint if the given variables take the given values
+		double reference_error( int constraint_id, const std::vector<int>& variables, const std::vector<int>& values )
+		{
+			std::vector<int> old_values;
+			for( int i = 0 ; i < static_cast<int>( variables.size() ) ; ++i )
+			{
+				old_values.push_back( _reference.variables[ variables[ i ] ].get_value() );
+				_reference.variables[ variables[ i ] ].set_value( values[ i ] );
+			}
+
+			double error = _reference.constraints[ constraint_id ]->error();
+
+			for( int i = 0 ; i < static_cast<int>( variables.size() ) ; ++i )
+				_reference.variables[ variables[ i ] ].set_value( old_values[ i ] );
+
+			return error;
+		}
+
+		// Two variables with different values that can be swapped, or an empty vector if none is found
+		std::vector<int> random_swap()
+		{
+			for( int attempt = 0 ; attempt < 100 ; ++attempt )
+			{
+				int first = random_variable();
+				int second = random_variable();
+				int first_value = _model.variables[ first ].get_value();
+				int second_value = _model.variables[ second ].get_value();
+				if( first_value != second_value && in_domain( first, second_value ) && in_domain( second, first_value ) )
+					return { first, second };
+			}
+
+			return {};
+		}
+
+		void check_move( const std::vector<int>& variables, const std::vector<int>& values, bool swap )
+		{
+			for( int constraint_id = 0 ; constraint_id < static_cast<int>( _model.constraints.size() ) ; ++constraint_id )
+			{
+				auto& constraint = _model.constraints[ constraint_id ];
+				std::vector<int> changed_variables;
+				std::vector<int> changed_values;
+				for( int i = 0 ; i < static_cast<int>( variables.size() ) ; ++i )
+					if( constraint->has_variable( variables[ i ] ) )
+					{
+						changed_variables.push_back( variables[ i ] );
+						changed_values.push_back( values[ i ] );
+					}
+
+				if( changed_variables.empty() || ( swap && constraint->_is_permutation_invariant && changed_variables.size() == 2 ) )
+					continue;
+
+				double error_before = reference_error( constraint_id, {}, {} );
+				double error_after = reference_error( constraint_id, changed_variables, changed_values );
+				EXPECT_NEAR( constraint->get_current_error(), error_before, 1e-9 ) << "constraint " << constraint_id;
+
+				double delta = error_after - error_before;
+				try
+				{
+					delta = constraint->delta_error( changed_variables, changed_values );
+					EXPECT_NEAR( delta, error_after - error_before, 1e-9 ) << "constraint " << constraint_id;
+				}
+				catch( Constraint::deltaErrorNotDefinedException& ) { }
+
+				// Changing only one of the moved variables, to any value of its domain
+				for( int variable_id : changed_variables )
+				{
+					const auto& domain = _model.variables[ variable_id ].get_full_domain();
+					std::vector<double> expected_deltas;
+					for( int value : domain )
+						expected_deltas.push_back( reference_error( constraint_id, { variable_id }, { value } ) - error_before );
+
+					try
+					{
+						for( int value_index = 0 ; value_index < static_cast<int>( domain.size() ) ; ++value_index )
+							EXPECT_NEAR( constraint->delta_error( { variable_id }, { domain[ value_index ] } ), expected_deltas[ value_index ], 1e-9 )
+								<< "constraint " << constraint_id << ", variable " << variable_id << ", value " << domain[ value_index ];
+					}
+					catch( Constraint::deltaErrorNotDefinedException& ) { }
+
+					try
+					{
+						auto deltas = constraint->delta_error_on_domain( variable_id, domain );
+						for( int value_index = 0 ; value_index < static_cast<int>( domain.size() ) ; ++value_index )
+							EXPECT_NEAR( deltas[ value_index ], expected_deltas[ value_index ], 1e-9 )
+								<< "constraint " << constraint_id << ", variable " << variable_id << ", value " << domain[ value_index ];
+					}
+					catch( Constraint::deltaErrorOnDomainNotDefinedException& ) { }
+				}
+
+				// Data structures are updated while all variables still have their old values
+				constraint->_current_error += delta;
+				for( int i = 0 ; i < static_cast<int>( changed_variables.size() ) ; ++i )
+					constraint->update( changed_variables[ i ], changed_values[ i ] );
+			}
+
+			for( int i = 0 ; i < static_cast<int>( variables.size() ) ; ++i )
+			{
+				_model.variables[ variables[ i ] ].set_value( values[ i ] );
+				_reference.variables[ variables[ i ] ].set_value( values[ i ] );
+			}
+		}
+
+	public:
+		ConstraintChecker( ModelBuilder& builder, unsigned int seed = 0 )
+			: _model( builder.build_model() ),
+			  _reference( builder.build_model() ),
+			  _rng( seed )
+		{
+			// Random starting assignment, keeping permutations in permutation problems
+			for( int i = 0 ; i < 10 * static_cast<int>( _model.variables.size() ) ; ++i )
+				if( _model.permutation_problem )
+				{
+					auto swapped = random_swap();
+					if( !swapped.empty() )
+					{
+						int value = _model.variables[ swapped[ 0 ] ].get_value();
+						_model.variables[ swapped[ 0 ] ].set_value( _model.variables[ swapped[ 1 ] ].get_value() );
+						_model.variables[ swapped[ 1 ] ].set_value( value );
+					}
+				}
+				else
+				{
+					int variable_id = random_variable();
+					_model.variables[ variable_id ].set_value( random_value( variable_id ) );
+				}
+
+			for( int variable_id = 0 ; variable_id < static_cast<int>( _model.variables.size() ) ; ++variable_id )
+				_reference.variables[ variable_id ].set_value( _model.variables[ variable_id ].get_value() );
+
+			for( auto& constraint : _model.constraints )
+				constraint->_current_error = constraint->error();
+		}
+
+		// Apply random moves: swaps in permutation problems, changes of one or two variables otherwise
+		void check_random_moves( int number_moves )
+		{
+			for( int move = 0 ; move < number_moves && !::testing::Test::HasFailure() ; ++move )
+				if( _model.permutation_problem )
+				{
+					auto swapped = random_swap();
+					if( !swapped.empty() )
+						check_move( swapped,
+						            { _model.variables[ swapped[ 1 ] ].get_value(), _model.variables[ swapped[ 0 ] ].get_value() },
+						            true );
+				}
+				else
+				{
+					std::vector<int> variables;
+					std::vector<int> values;
+					for( int i = 0 ; i < 1 + move % 2 ; ++i )
+					{
+						int variable_id = random_variable();
+						int value = random_value( variable_id );
+						if( value != _model.variables[ variable_id ].get_value() && std::find( variables.begin(), variables.end(), variable_id ) == variables.end() )
+						{
+							variables.push_back( variable_id );
+							values.push_back( value );
+						}
+					}
+
+					if( !variables.empty() )
+						check_move( variables, values, false );
+				}
+		}
+	};
+}
+
+class CumulativeBuilder : public ghost::ModelBuilder
+{
+public:
+	std::vector<int> durations{ 3, 2, 4, 1, 2 };
+	std::vector<int> demands{ 2, 1, 2, 3, 1 };
+	int capacity = 3;
+
+	void declare_variables() override
+	{
+		create_n_variables( 5, 0, 8 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::Cumulative>( variables, durations, demands, capacity ) );
+	}
+};
+
+TEST(GlobalConstraintsTest, Cumulative)
+{
+	CumulativeBuilder builder;
+	ghost::ConstraintChecker checker( builder );
+	checker.check_random_moves( 1000 );
+}
+
+class CardinalityBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 10, 0, 5 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::GlobalCardinality>( variables,
+		                                                                                        std::vector<int>{ 0, 1, 2 },
+		                                                                                        std::vector<int>{ 1, 2, 0 },
+		                                                                                        std::vector<int>{ 3, 4, 2 } ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AtLeast>( variables, 3, 2 ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AtMost>( variables, 4, 1 ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::Count>( variables, 1, 3 ) );
+	}
+};
+
+TEST(GlobalConstraintsTest, GlobalCardinality)
+{
+	CardinalityBuilder builder;
+	ghost::ConstraintChecker checker( builder );
+	checker.check_random_moves( 1000 );
+}
+
+// All constraints define plausible values, so the solver filters candidate values before simulating them
+class PlausibleValuesBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 8, 0, 12 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::GlobalCardinality>( variables,
+		                                                                                        std::vector<int>{ 0, 1, 2, 3 },
+		                                                                                        std::vector<int>{ 1, 1, 1, 1 } ) );
+	}
+};
+
+TEST(GlobalConstraintsTest, PlausibleValues)
+{
+	PlausibleValuesBuilder builder;
+	ghost::Solver solver( builder );
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 100ms ) );
+	EXPECT_EQ( cost, 0.0 );
+
+	auto sorted = solution;
+	std::sort( sorted.begin(), sorted.end() );
+	EXPECT_EQ( std::adjacent_find( sorted.begin(), sorted.end() ), sorted.end() );
+	for( int value = 0 ; value < 4 ; ++value )
+		EXPECT_EQ( std::count( solution.begin(), solution.end(), value ), 1 );
+}
+
+class CircuitBuilder : public ghost::ModelBuilder
+{
+public:
+	CircuitBuilder( bool permutation_problem = true )
+		: ModelBuilder( permutation_problem )
+	{ }
+
+	void declare_variables() override
+	{
+		// Successor variables, starting with self-loops
+		for( int node = 0 ; node < 8 ; ++node )
+			variables.emplace_back( 0, 8, node );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::Circuit>( variables ) );
+	}
+};
+
+TEST(GlobalConstraintsTest, Circuit)
+{
+	CircuitBuilder builder;
+	ghost::Solver solver( builder );
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 100ms ) );
+	EXPECT_EQ( cost, 0.0 );
+
+	// Following successors from node 0 must visit all nodes before coming back
+	std::vector<bool> visited( 8, false );
+	int node = 0;
+	for( int step = 0 ; step < 8 ; ++step )
+	{
+		EXPECT_FALSE( visited[ node ] );
+		visited[ node ] = true;
+		node = solution[ node ];
+	}
+	EXPECT_EQ( node, 0 );
+}
+
+TEST(GlobalConstraintsTest, CircuitDeltaError)
+{
+	// Random permutations, where changing a successor or swapping two successors is evaluated from cycle labels
+	CircuitBuilder builder;
+	ghost::ConstraintChecker checker( builder );
+	checker.check_random_moves( 1000 );
+
+	// Any assignments, where delta errors are computed from scratch
+	CircuitBuilder non_permutation_builder( false );
+	ghost::ConstraintChecker non_permutation_checker( non_permutation_builder );
+	non_permutation_checker.check_random_moves( 1000 );
+}
+
+class BinPackingBuilder : public ghost::ModelBuilder
+{
+public:
+	std::vector<double> weights{ 4, 3, 3, 2, 2, 2, 1, 1 };
+	std::vector<double> capacities{ 6, 6, 6 };
+
+	void declare_variables() override
+	{
+		create_n_variables( 8, 0, 3 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::BinPacking>( variables, weights, capacities ) );
+	}
+};
+
+TEST(GlobalConstraintsTest, BinPacking)
+{
+	BinPackingBuilder builder;
+	ghost::ConstraintChecker checker( builder );
+	checker.check_random_moves( 1000 );
+}
+
+class RegularBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		// 1 for working days, 0 for days off
+		create_n_variables( 10, 0, 2 );
+	}
+
+	void declare_constraints() override
+	{
+		// State q means q consecutive working days so far, no more than 2 allowed
+		std::vector<std::tuple<int,int,int>> transitions{ { 0, 0, 0 }, { 1, 0, 0 }, { 2, 0, 0 }, { 0, 1, 1 }, { 1, 1, 2 } };
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::Regular>( variables, 3, 0, std::vector<int>{ 0, 1, 2 }, transitions ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AtLeast>( variables, 1, 6 ) );
+	}
+};
+
+TEST(GlobalConstraintsTest, Regular)
+{
+	RegularBuilder builder;
+	ghost::Solver solver( builder );
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 100ms ) );
+	EXPECT_EQ( cost, 0.0 );
+
+	EXPECT_GE( std::count( solution.begin(), solution.end(), 1 ), 6 );
+	for( int day = 0 ; day + 2 < 10 ; ++day )
+		EXPECT_LT( solution[ day ] + solution[ day + 1 ] + solution[ day + 2 ], 3 );
+}
+
+TEST(GlobalConstraintsTest, RegularDeltaError)
+{
+	// Sequences of moves keep forward and backward automaton rows, and change costs, partially valid
+	RegularBuilder builder;
+	ghost::ConstraintChecker checker( builder );
+	checker.check_random_moves( 1000 );
+}
+
+class ElementBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		// x, y, row, column, z
+		create_n_variables( 5, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::Element>( variables[0], variables[1], std::vector<int>{ 3, 8, 1, 9, 4 } ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::Element2D>( variables[2],
+		                                                                                 variables[3],
+		                                                                                 variables[4],
+		                                                                                 std::vector<std::vector<int>>{ { 2, 5, 0 }, { 6, 1, 7 } } ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::FixValue>( std::vector<int>{ 1 }, 9 ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::FixValue>( std::vector<int>{ 4 }, 7 ) );
+	}
+};
+
+TEST(GlobalConstraintsTest, Element)
+{
+	ElementBuilder builder;
+	ghost::ConstraintChecker checker( builder );
+	checker.check_random_moves( 1000 );
+}
+
+TEST(GlobalConstraintsTest, ElementInvalidArrays)
+{
+	EXPECT_THROW( ghost::global_constraints::Element( 0, 1, std::vector<int>{} ), ghost::global_constraints::Element::emptyArrayException );
+	EXPECT_THROW( ghost::global_constraints::Element2D( 0, 1, 2, std::vector<std::vector<int>>{} ), ghost::global_constraints::Element2D::matrixException );
+	EXPECT_THROW( ghost::global_constraints::Element2D( 0, 1, 2, std::vector<std::vector<int>>{ {}, {} } ), ghost::global_constraints::Element2D::matrixException );
+	EXPECT_THROW( ghost::global_constraints::Element2D( 0, 1, 2, std::vector<std::vector<int>>{ { 2, 5, 0 }, { 6, 1 } } ), ghost::global_constraints::Element2D::matrixException );
+	EXPECT_NO_THROW( ghost::global_constraints::Element2D( 0, 1, 2, std::vector<std::vector<int>>{ { 2, 5, 0 }, { 6, 1, 7 } } ) );
+}
+
+class GraphDifferentBuilder : public ghost::ModelBuilder
+{
+public:
+	// Petersen graph, with chromatic number 3
+	std::vector<std::pair<int,int>> edges{ { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 4 }, { 4, 0 },
+	                                       { 0, 5 }, { 1, 6 }, { 2, 7 }, { 3, 8 }, { 4, 9 },
+	                                       { 5, 7 }, { 7, 9 }, { 9, 6 }, { 6, 8 }, { 8, 5 } };
+
+	void declare_variables() override
+	{
+		create_n_variables( 10, 0, 3 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::GraphDifferent>( variables, edges ) );
+	}
+};
+
+TEST(GlobalConstraintsTest, GraphDifferent)
+{
+	GraphDifferentBuilder builder;
+	ghost::ConstraintChecker checker( builder );
+	checker.check_random_moves( 1000 );
+}
+
+// User-defined constraint x < y, evaluating batches of samplings itself
+class LessThan : public ghost::Constraint
+{
+	int* _batched_samples;
+
+	double required_error( const std::vector<ghost::Variable*>& variables ) const override
+	{
+		return std::max( 0, variables[0]->get_value() - variables[1]->get_value() + 1 );
+	}
+
+	std::vector<double> optional_batch_error( const std::vector<ghost::Variable*>&,
+	                                          const std::vector<int>& values,
+	                                          int number_samples ) const override
+	{
+		std::vector<double> errors( number_samples );
+		for( int k = 0 ; k < number_samples ; ++k )
+			errors[k] = std::max( 0, values[k] - values[ number_samples + k ] + 1 );
+
+		*_batched_samples += number_samples;
+		return errors;
+	}
+
+public:
+	LessThan( const std::vector<int>& variables_index, int* batched_samples )
+		: Constraint( variables_index ),
+		  _batched_samples( batched_samples )
+	{ }
+};
+
+// Built-in constraints with batched errors, on small and large scopes, mixed with constraints evaluated sampling after sampling
+class BatchErrorBuilder : public ghost::ModelBuilder
+{
+	int* _batched_samples;
+
+public:
+	BatchErrorBuilder( int* batched_samples )
+		: ModelBuilder(),
+		  _batched_samples( batched_samples )
+	{ }
+
+	void declare_variables() override
+	{
+		create_n_variables( 40, 0, 80 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( std::vector<int>{ 0, 1, 2, 3, 4 } ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::LinearEquationEq>( std::vector<int>{ 0, 1, 2 }, 30 ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::FixValue>( std::vector<int>{ 39 }, 39 ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::GlobalCardinality>( std::vector<int>{ 10, 11, 12 },
+		                                                                                        std::vector<int>{ 3, 4 },
+		                                                                                        std::vector<int>{ 0, 0 },
+		                                                                                        std::vector<int>{ 1, 1 } ) );
+		constraints.emplace_back( std::make_shared<LessThan>( std::vector<int>{ 20, 21 }, _batched_samples ) );
+	}
+};
+
+TEST(GlobalConstraintsTest, BatchError)
+{
+	int batched_samples = 0;
+	BatchErrorBuilder builder( &batched_samples );
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	options.number_start_samplings = 100;
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 1s, options ) );
+	EXPECT_EQ( cost, 0.0 );
+
+	// No sampling satisfies all constraints, so all 100 samplings have been evaluated by batches,
+	// on top of the probe with the starting assignment
+	EXPECT_GE( batched_samples, 101 );
+
+	auto sorted = solution;
+	std::sort( sorted.begin(), sorted.end() );
+	EXPECT_EQ( std::adjacent_find( sorted.begin(), sorted.end() ), sorted.end() );
+	EXPECT_EQ( solution[0] + solution[1] + solution[2], 30 );
+	EXPECT_EQ( solution[39], 39 );
+	EXPECT_LT( solution[20], solution[21] );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
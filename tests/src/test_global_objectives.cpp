@@ -0,0 +1,80 @@
+#include <ghost/solver.hpp>
+#include <ghost/global_constraints/all_different.hpp>
+#include <ghost/global_constraints/cumulative.hpp>
+#include <ghost/global_objectives/maximize_min.hpp>
+#include <ghost/global_objectives/minimize_max.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace std::literals::chrono_literals;
+
+class MakespanBuilder : public ghost::ModelBuilder
+{
+public:
+	std::vector<int> durations{ 2, 3, 1, 2 };
+
+	void declare_variables() override
+	{
+		create_n_variables( 4, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		// Tasks cannot overlap
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::Cumulative>( variables, durations, std::vector<int>( 4, 1 ), 1 ) );
+	}
+
+	void declare_objective() override
+	{
+		objective = std::make_shared<ghost::global_objectives::MinimizeMax>( variables, durations );
+	}
+};
+
+class SpreadBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 4, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+	}
+
+	void declare_objective() override
+	{
+		objective = std::make_shared<ghost::global_objectives::MaximizeMin>( variables );
+	}
+};
+
+TEST(GlobalObjectivesTest, MinimizeMax)
+{
+	MakespanBuilder builder;
+	ghost::Solver solver( builder );
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 100ms ) );
+	EXPECT_EQ( cost, 8.0 );
+}
+
+TEST(GlobalObjectivesTest, MaximizeMin)
+{
+	SpreadBuilder builder;
+	ghost::Solver solver( builder );
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 100ms ) );
+	EXPECT_EQ( cost, 6.0 );
+	EXPECT_EQ( *std::min_element( solution.begin(), solution.end() ), 6 );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
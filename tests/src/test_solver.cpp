@@ -0,0 +1,791 @@
+#include <ghost/solver.hpp>
+#include <ghost/global_constraints/all_different.hpp>
+#include <ghost/global_constraints/bin_packing.hpp>
+#include <ghost/global_constraints/graph_different.hpp>
+#include <ghost/global_constraints/linear_equation_eq.hpp>
+#include <ghost/global_objectives/maximize_min.hpp>
+#include <ghost/algorithms/swap_neighborhood.hpp>
+#include <ghost/algorithms/k_exchange_neighborhood.hpp>
+#include <ghost/algorithms/shift_neighborhood.hpp>
+#include <ghost/algorithms/variable_candidates.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+using namespace std::literals::chrono_literals;
+
+class PermutationBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 12, 0, 12 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+	}
+};
+
+class SpreadBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 4, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+	}
+
+	void declare_objective() override
+	{
+		objective = std::make_shared<ghost::global_objectives::MaximizeMin>( variables );
+	}
+};
+
+class SmallSpreadBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 3, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+	}
+
+	void declare_objective() override
+	{
+		objective = std::make_shared<ghost::global_objectives::MaximizeMin>( variables );
+	}
+};
+
+class InfeasibleBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 3, 0, 2 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+	}
+};
+
+// Sum constraint with a slow delta error, to get search iterations lasting several milliseconds
+class SlowSum : public ghost::Constraint
+{
+	int _target;
+
+	double required_error( const std::vector<ghost::Variable*>& variables ) const override
+	{
+		int sum = std::accumulate( variables.begin(), variables.end(), 0, []( int total, auto variable ){ return total + variable->get_value(); } );
+		return std::abs( sum - _target );
+	}
+
+	double optional_delta_error( const std::vector<ghost::Variable*>& variables, const std::vector<int>& indexes, const std::vector<int>& candidate_values ) const override
+	{
+		auto start = std::chrono::steady_clock::now();
+		while( std::chrono::steady_clock::now() - start < 100us ) { }
+
+		int sum = std::accumulate( variables.begin(), variables.end(), 0, []( int total, auto variable ){ return total + variable->get_value(); } );
+		int new_sum = sum;
+		for( int i = 0 ; i < static_cast<int>( indexes.size() ) ; ++i )
+			new_sum += candidate_values[i] - variables[ indexes[i] ]->get_value();
+
+		return std::abs( new_sum - _target ) - std::abs( sum - _target );
+	}
+
+public:
+	SlowSum( const std::vector<ghost::Variable>& variables, int target )
+		: Constraint( variables ),
+		  _target( target )
+	{ }
+};
+
+class SlowBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 10, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		// Unsatisfiable constraints, so that the search never stops by itself.
+		// Each search iteration evaluates 10 constraints * 9 values, i.e., lasts about 9ms
+		for( int i = 0 ; i < 10 ; ++i )
+			constraints.emplace_back( std::make_shared<SlowSum>( variables, -1 ) );
+	}
+};
+
+// Sum of the descents of a sequence, which changing a single value rarely decreases
+class Sorted : public ghost::Constraint
+{
+	double required_error( const std::vector<ghost::Variable*>& variables ) const override
+	{
+		double error = 0.0;
+		for( int i = 0 ; i + 1 < static_cast<int>( variables.size() ) ; ++i )
+			error += std::max( 0, variables[i]->get_value() - variables[i + 1]->get_value() );
+		return error;
+	}
+
+public:
+	Sorted( const std::vector<ghost::Variable>& variables )
+		: Constraint( variables )
+	{ }
+};
+
+class SortedBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		for( int i = 0 ; i < 10 ; ++i )
+			variables.emplace_back( 0, 10, 9 - i );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+		constraints.emplace_back( std::make_shared<Sorted>( variables ) );
+	}
+};
+
+// Permutation-invariant constraint counting how many times the solver updates it
+class CountedUpdates : public ghost::Constraint
+{
+	std::shared_ptr<int> _updates;
+
+	double required_error( const std::vector<ghost::Variable*>& ) const override
+	{
+		return 0.0;
+	}
+
+	bool optional_is_permutation_invariant( const std::vector<ghost::Variable*>& ) const override
+	{
+		return true;
+	}
+
+	void conditional_update_data_structures( const std::vector<ghost::Variable*>&, int, int ) override
+	{
+		++*_updates;
+	}
+
+public:
+	CountedUpdates( const std::vector<ghost::Variable>& variables, std::shared_ptr<int> updates )
+		: Constraint( variables ),
+		  _updates( updates )
+	{ }
+};
+
+class PermutationSortedBuilder : public ghost::ModelBuilder
+{
+public:
+	int number_variables;
+	std::shared_ptr<int> updates;
+
+	PermutationSortedBuilder( int number_variables = 10 )
+		: ModelBuilder( true ),
+		  number_variables( number_variables ),
+		  updates( std::make_shared<int>( 0 ) )
+	{ }
+
+	void declare_variables() override
+	{
+		for( int i = 0 ; i < number_variables ; ++i )
+			variables.emplace_back( 0, number_variables, number_variables - 1 - i );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<Sorted>( variables ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::LinearEquationEq>( variables, number_variables * ( number_variables - 1 ) / 2 ) );
+		constraints.emplace_back( std::make_shared<CountedUpdates>( variables, updates ) );
+	}
+};
+
+// Constraint reporting the memory taken by its inner data structures
+class Buffered : public ghost::Constraint
+{
+	std::vector<int> _buffer;
+
+	double required_error( const std::vector<ghost::Variable*>& ) const override
+	{
+		return 0.0;
+	}
+
+	std::size_t optional_memory_usage( const std::vector<ghost::Variable*>& ) const override
+	{
+		return ghost::MemoryUsage::heap_bytes( _buffer );
+	}
+
+public:
+	Buffered( const std::vector<ghost::Variable>& variables )
+		: Constraint( variables ),
+		  _buffer( 1000 )
+	{ }
+};
+
+class BufferedBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 12, 0, 12 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+		constraints.emplace_back( std::make_shared<Buffered>( variables ) );
+	}
+};
+
+// Moves keeping the sum of values: increment one variable and decrement another one
+class TransferNeighborhood : public ghost::algorithms::Neighborhood
+{
+public:
+	TransferNeighborhood()
+		: Neighborhood( "Transfer" )
+	{ }
+
+	std::vector<ghost::algorithms::Move> get_moves( int variable_to_change,
+	                                                const ghost::SearchUnitData& data,
+	                                                const ghost::Model& model,
+	                                                randutils::mt19937_rng& ) const override
+	{
+		std::vector<ghost::algorithms::Move> moves;
+		int value = model.variables[ variable_to_change ].get_value();
+
+		for( int variable_id = 0 ; variable_id < data.number_variables ; ++variable_id )
+			if( variable_id != variable_to_change )
+			{
+				int other_value = model.variables[ variable_id ].get_value();
+				for( int transfer : { -1, 1 } )
+					if( model.variables[ variable_to_change ].is_in_domain( value + transfer ) && model.variables[ variable_id ].is_in_domain( other_value - transfer ) )
+						moves.push_back( ghost::algorithms::Move{ { variable_to_change, variable_id }, { value + transfer, other_value - transfer } } );
+			}
+
+		return moves;
+	}
+};
+
+class SumOfSquares : public ghost::Minimize
+{
+	double required_cost( const std::vector<ghost::Variable*>& variables ) const override
+	{
+		return std::accumulate( variables.begin(), variables.end(), 0.0, []( double total, auto variable ){ return total + variable->get_value() * variable->get_value(); } );
+	}
+
+public:
+	SumOfSquares( const std::vector<ghost::Variable>& variables )
+		: Minimize( variables, "Sum of squares" )
+	{ }
+};
+
+class BalanceBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 5, 0, 11 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::LinearEquationEq>( variables, 20 ) );
+	}
+
+	void declare_objective() override
+	{
+		objective = std::make_shared<SumOfSquares>( variables );
+	}
+};
+
+// 400 items packed into 10 bins, where items 2k and 2k+1 go to the same bin, but not item 2k+2
+class PairedItemsBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 400, 0, 10 );
+	}
+
+	void declare_constraints() override
+	{
+		std::vector<std::pair<int,int>> edges;
+		for( int item = 0 ; item < 400 ; item += 2 )
+		{
+			constraints.emplace_back( std::make_shared<ghost::global_constraints::LinearEquationEq>( std::vector<ghost::Variable>{ variables[ item ], variables[ item + 1 ] },
+			                                                                                         0,
+			                                                                                         std::vector<double>{ 1, -1 } ) );
+			if( item + 2 < 400 )
+				edges.emplace_back( item + 1, item + 2 );
+		}
+
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::GraphDifferent>( variables, edges ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::BinPacking>( variables, std::vector<double>( 400, 1.0 ), 10, 44.0 ) );
+	}
+};
+
+// User-defined constraint without coarse version
+class Different : public ghost::Constraint
+{
+	double required_error( const std::vector<ghost::Variable*>& variables ) const override
+	{
+		return variables[0]->get_value() == variables[1]->get_value() ? 1.0 : 0.0;
+	}
+
+public:
+	Different( const std::vector<ghost::Variable>& variables )
+		: Constraint( variables )
+	{ }
+};
+
+// 3-coloring of a path, with a sum constraint
+class PathColoringBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 500, 0, 3 );
+	}
+
+	void declare_constraints() override
+	{
+		for( int i = 0 ; i + 1 < 500 ; ++i )
+			constraints.emplace_back( std::make_shared<Different>( std::vector<ghost::Variable>{ variables[i], variables[i + 1] } ) );
+
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::LinearEquationEq>( variables, 500 ) );
+	}
+};
+
+TEST(SolverTest, StepWithoutBegin)
+{
+	PermutationBuilder builder;
+	ghost::Solver solver( builder );
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_FALSE( solver.step( 10 ) );
+	EXPECT_FALSE( solver.best( cost, solution ) );
+	EXPECT_FALSE( solver.end( cost, solution ) );
+}
+
+TEST(SolverTest, StepByIterations)
+{
+	PermutationBuilder builder;
+	ghost::Solver solver( builder );
+
+	solver.begin();
+
+	double cost;
+	std::vector<int> solution;
+	int slices = 0;
+	while( solver.step( 1 ) && slices < 100000 )
+	{
+		++slices;
+		// best candidate so far is available between two slices
+		solver.best( cost, solution );
+		EXPECT_EQ( solution.size(), 12 );
+	}
+
+	EXPECT_TRUE( solver.best( cost, solution ) );
+	EXPECT_EQ( cost, 0.0 );
+
+	EXPECT_TRUE( solver.end( cost, solution ) );
+	EXPECT_EQ( cost, 0.0 );
+	std::sort( solution.begin(), solution.end() );
+	EXPECT_EQ( std::adjacent_find( solution.begin(), solution.end() ), solution.end() );
+}
+
+TEST(SolverTest, StepByDeadline)
+{
+	SpreadBuilder builder;
+	ghost::Solver solver( builder );
+
+	solver.begin();
+
+	// Optimization problems run until the caller stops giving time slices
+	for( int slice = 0 ; slice < 200 ; ++slice )
+		EXPECT_TRUE( solver.step( 500us ) );
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.best( cost, solution ) );
+	EXPECT_EQ( cost, *std::min_element( solution.begin(), solution.end() ) );
+
+	EXPECT_TRUE( solver.end( cost, solution ) );
+	EXPECT_EQ( cost, 6.0 );
+}
+
+TEST(SolverTest, DeadlineWithinIterations)
+{
+	SlowBuilder builder;
+	ghost::Solver solver( builder );
+
+	solver.begin();
+	for( int slice = 0 ; slice < 20 ; ++slice )
+		EXPECT_TRUE( solver.step( 1ms ) );
+
+	double cost;
+	std::vector<int> solution;
+	solver.end( cost, solution );
+
+	// The deadline is checked between two constraint evaluations, not only between two iterations
+	EXPECT_LT( solver.get_worst_deadline_overshoot(), 5000.0 );
+}
+
+TEST(SolverTest, TargetCost)
+{
+	SpreadBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	options.target_cost = 6;
+
+	double cost;
+	std::vector<int> solution;
+	auto start = std::chrono::steady_clock::now();
+	EXPECT_TRUE( solver.solve( cost, solution, 10s, options ) );
+	EXPECT_LT( std::chrono::steady_clock::now() - start, 5s );
+	EXPECT_EQ( cost, 6.0 );
+}
+
+TEST(SolverTest, TargetCostParallel)
+{
+	SpreadBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	options.target_cost = 6;
+	options.parallel_runs = true;
+	options.number_threads = 2;
+
+	double cost;
+	std::vector<int> solution;
+	auto start = std::chrono::steady_clock::now();
+	EXPECT_TRUE( solver.solve( cost, solution, 10s, options ) );
+	EXPECT_LT( std::chrono::steady_clock::now() - start, 5s );
+	EXPECT_EQ( cost, 6.0 );
+}
+
+TEST(SolverTest, Stagnation)
+{
+	SpreadBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	options.stagnation_iterations = 10000;
+
+	double cost;
+	std::vector<int> solution;
+	auto start = std::chrono::steady_clock::now();
+	EXPECT_TRUE( solver.solve( cost, solution, 10s, options ) );
+	EXPECT_LT( std::chrono::steady_clock::now() - start, 5s );
+
+	options.stagnation_iterations = -1;
+	options.stagnation_percent_budget = 5;
+	start = std::chrono::steady_clock::now();
+	EXPECT_TRUE( solver.solve( cost, solution, 10s, options ) );
+	EXPECT_LT( std::chrono::steady_clock::now() - start, 5s );
+}
+
+TEST(SolverTest, Neighborhoods)
+{
+	SortedBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	options.neighborhoods = { std::make_shared<ghost::algorithms::SwapNeighborhood>(),
+	                          std::make_shared<ghost::algorithms::KExchangeNeighborhood>( 3, 20 ),
+	                          std::make_shared<ghost::algorithms::ShiftNeighborhood>( 3 ) };
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 500ms, options ) );
+	EXPECT_EQ( cost, 0.0 );
+	EXPECT_TRUE( std::is_sorted( solution.begin(), solution.end() ) );
+	EXPECT_EQ( std::adjacent_find( solution.begin(), solution.end() ), solution.end() );
+}
+
+TEST(SolverTest, UserDefinedNeighborhood)
+{
+	BalanceBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	options.neighborhoods = { std::make_shared<TransferNeighborhood>() };
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 100ms, options ) );
+	EXPECT_EQ( cost, 80.0 );
+	EXPECT_THAT( solution, ::testing::Each( 4 ) );
+}
+
+TEST(SolverTest, PermutationInvariantConstraints)
+{
+	PermutationSortedBuilder builder;
+	ghost::Solver solver( builder );
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 500ms ) );
+	EXPECT_EQ( cost, 0.0 );
+	EXPECT_TRUE( std::is_sorted( solution.begin(), solution.end() ) );
+	EXPECT_EQ( std::accumulate( solution.begin(), solution.end(), 0 ), 45 );
+	// Swaps are all within the scope of the constraint
+	EXPECT_EQ( *builder.updates, 0 );
+}
+
+TEST(SolverTest, Multilevel)
+{
+	PairedItemsBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	options.multilevel = true;
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 2s, options ) );
+	EXPECT_EQ( cost, 0.0 );
+	for( int item = 0 ; item < 400 ; item += 2 )
+	{
+		EXPECT_EQ( solution[ item ], solution[ item + 1 ] );
+		if( item + 2 < 400 )
+		{
+			EXPECT_NE( solution[ item + 1 ], solution[ item + 2 ] );
+		}
+	}
+	for( int bin = 0 ; bin < 10 ; ++bin )
+		EXPECT_LE( std::count( solution.begin(), solution.end(), bin ), 44 );
+}
+
+TEST(SolverTest, MultilevelUserConstraints)
+{
+	PathColoringBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	options.multilevel = true;
+	options.multilevel_coarsest_size = 50;
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 2s, options ) );
+	EXPECT_EQ( cost, 0.0 );
+	EXPECT_EQ( std::accumulate( solution.begin(), solution.end(), 0 ), 500 );
+	EXPECT_EQ( std::adjacent_find( solution.begin(), solution.end() ), solution.end() );
+}
+
+TEST(SolverTest, ConfigurationChecking)
+{
+	PathColoringBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	options.configuration_checking = true;
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 2s, options ) );
+	EXPECT_EQ( cost, 0.0 );
+	EXPECT_EQ( std::accumulate( solution.begin(), solution.end(), 0 ), 500 );
+	EXPECT_EQ( std::adjacent_find( solution.begin(), solution.end() ), solution.end() );
+
+	SpreadBuilder spread_builder;
+	ghost::Solver spread_solver( spread_builder );
+	options.target_cost = 6;
+	EXPECT_TRUE( spread_solver.solve( cost, solution, 10s, options ) );
+	EXPECT_EQ( cost, 6.0 );
+}
+
+TEST(SolverTest, MemoryUsage)
+{
+	BufferedBuilder builder;
+	ghost::Solver solver( builder );
+
+	auto usage = solver.memory_usage();
+	EXPECT_EQ( usage.get( "solver model / variables" ), 0u );
+	EXPECT_GE( usage.get( "search unit / model / variables" ), 12 * sizeof( ghost::Variable ) );
+	EXPECT_GE( usage.get( "search unit / model / constraint states" ), 1000 * sizeof( int ) );
+	EXPECT_GE( usage.get( "search unit / variables at start" ), 12 * sizeof( ghost::Variable ) );
+	EXPECT_GT( usage.get( "search unit / variable-constraint incidence" ), 0u );
+	std::size_t total = 0;
+	for( const auto& structure : usage.get_breakdown() )
+		total += structure.second;
+	EXPECT_EQ( usage.total(), total );
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 100ms ) );
+	usage = solver.memory_usage();
+	EXPECT_GE( usage.get( "solver model / constraint states" ), 1000 * sizeof( int ) );
+
+	EXPECT_EQ( ghost::MemoryUsage::heap_bytes( std::string( "v1" ) ), 0u );
+	EXPECT_GT( ghost::MemoryUsage::heap_bytes( std::string( 100, 'v' ) ), 100u );
+}
+
+TEST(SolverTest, ExhaustiveSearch)
+{
+	// 1000 assignments: enumerated once the threshold allows it, stopping long before the timeout
+	SmallSpreadBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	options.exhaustive_search_threshold = 1000;
+
+	double cost;
+	std::vector<int> solution;
+	auto start = std::chrono::steady_clock::now();
+	EXPECT_TRUE( solver.solve( cost, solution, 10s, options ) );
+	EXPECT_LT( std::chrono::steady_clock::now() - start, 5s );
+	EXPECT_EQ( cost, 7.0 );
+	EXPECT_EQ( *std::min_element( solution.begin(), solution.end() ), 7 );
+
+	ghost::Options parallel_options = options;
+	parallel_options.parallel_runs = true;
+	parallel_options.number_threads = 3;
+	start = std::chrono::steady_clock::now();
+	EXPECT_TRUE( solver.solve( cost, solution, 10s, parallel_options ) );
+	EXPECT_LT( std::chrono::steady_clock::now() - start, 5s );
+	EXPECT_EQ( cost, 7.0 );
+
+	// Unsatisfiable problems are proven so once the search space is exhausted
+	InfeasibleBuilder infeasible_builder;
+	ghost::Solver infeasible_solver( infeasible_builder );
+	start = std::chrono::steady_clock::now();
+	EXPECT_FALSE( infeasible_solver.solve( cost, solution, 10s, options ) );
+	EXPECT_LT( std::chrono::steady_clock::now() - start, 5s );
+	EXPECT_GT( cost, 0.0 );
+
+	// 720 permutations
+	PermutationSortedBuilder permutation_builder( 6 );
+	ghost::Solver permutation_solver( permutation_builder );
+	EXPECT_TRUE( permutation_solver.solve( cost, solution, 10s, options ) );
+	EXPECT_EQ( cost, 0.0 );
+	EXPECT_TRUE( std::is_sorted( solution.begin(), solution.end() ) );
+
+	// Disabled by default: the unsatisfiable problem runs until the timeout
+	start = std::chrono::steady_clock::now();
+	EXPECT_FALSE( infeasible_solver.solve( cost, solution, 500ms ) );
+	EXPECT_GE( std::chrono::steady_clock::now() - start, 500ms );
+}
+
+TEST(SolverTest, Intensification)
+{
+	SpreadBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	// Search units stop almost at once, leaving the optimum to the final intensification phase:
+	// moving the smallest value up always improves the objective function until reaching it.
+	options.stagnation_iterations = 1;
+	options.intensification_percent_budget = 50;
+
+	double cost;
+	std::vector<int> solution;
+	auto start = std::chrono::steady_clock::now();
+	EXPECT_TRUE( solver.solve( cost, solution, 10s, options ) );
+	EXPECT_LT( std::chrono::steady_clock::now() - start, 5s );
+	EXPECT_EQ( cost, 6.0 );
+	EXPECT_EQ( *std::min_element( solution.begin(), solution.end() ), 6 );
+
+	options.parallel_runs = true;
+	options.number_threads = 3;
+	options.intensification_top_k = 2;
+	start = std::chrono::steady_clock::now();
+	EXPECT_TRUE( solver.solve( cost, solution, 10s, options ) );
+	EXPECT_LT( std::chrono::steady_clock::now() - start, 5s );
+	EXPECT_EQ( cost, 6.0 );
+}
+
+TEST(SolverTest, VariableCandidates)
+{
+	ghost::algorithms::VariableCandidates candidates;
+	candidates.clear( 6 );
+	for( int variable_id : { 4, 1, 3, 1 } )
+		candidates.add( variable_id );
+	EXPECT_EQ( candidates.size(), 3 );
+	EXPECT_TRUE( candidates.get_weights().empty() );
+
+	candidates.remove( 4 );
+	candidates.remove( 5 );
+	EXPECT_EQ( candidates.size(), 2 );
+	EXPECT_FALSE( candidates.contains( 4 ) );
+	EXPECT_TRUE( candidates.contains( 1 ) );
+	EXPECT_TRUE( candidates.contains( 3 ) );
+	std::vector<int> ids = candidates.get_ids();
+	std::sort( ids.begin(), ids.end() );
+	EXPECT_THAT( ids, ::testing::ElementsAre( 1, 3 ) );
+
+	// Weights of removed candidates drop to 0, other weights are left unchanged
+	candidates.clear( 6, true );
+	EXPECT_TRUE( candidates.empty() );
+	for( int variable_id = 0 ; variable_id < 6 ; ++variable_id )
+	{
+		candidates.add( variable_id );
+		candidates.set_weight( variable_id, variable_id + 1.0 );
+	}
+	candidates.remove( 2 );
+	EXPECT_EQ( candidates.size(), 5 );
+	EXPECT_THAT( candidates.get_weights(), ::testing::ElementsAre( 1.0, 2.0, 0.0, 4.0, 5.0, 6.0 ) );
+	for( int i = 0 ; i < candidates.size() ; ++i )
+	{
+		EXPECT_TRUE( candidates.contains( candidates[ i ] ) );
+	}
+}
+
+class LargeBalanceBuilder : public ghost::ModelBuilder
+{
+public:
+	void declare_variables() override
+	{
+		create_n_variables( 50, 0, 11 );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::LinearEquationEq>( variables, 200 ) );
+	}
+
+	void declare_objective() override
+	{
+		objective = std::make_shared<SumOfSquares>( variables );
+	}
+};
+
+TEST(SolverTest, BestSolutionJournal)
+{
+	// Many more moves than variables: the best solution is rebuilt from journals restarted several times
+	LargeBalanceBuilder builder;
+	ghost::Solver solver( builder );
+	ghost::Options options;
+	options.neighborhoods = { std::make_shared<TransferNeighborhood>() };
+
+	double cost;
+	std::vector<int> solution;
+	EXPECT_TRUE( solver.solve( cost, solution, 200ms, options ) );
+	EXPECT_EQ( std::accumulate( solution.begin(), solution.end(), 0 ), 200 );
+	EXPECT_EQ( cost, std::inner_product( solution.begin(), solution.end(), solution.begin(), 0.0 ) );
+
+	solver.begin();
+	for( int slice = 0 ; slice < 20 ; ++slice )
+		solver.step( 5ms );
+	EXPECT_TRUE( solver.best( cost, solution ) );
+	EXPECT_EQ( cost, std::inner_product( solution.begin(), solution.end(), solution.begin(), 0.0 ) );
+	EXPECT_TRUE( solver.end( cost, solution ) );
+	EXPECT_EQ( std::accumulate( solution.begin(), solution.end(), 0 ), 200 );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
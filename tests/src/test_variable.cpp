@@ -174,6 +174,17 @@ TEST_F(VariableTest, GetDomainMaxValue)
 	EXPECT_EQ( var_ctor4.get_domain_max_value(), 22 );
 }
 
+TEST_F(VariableTest, IsInDomain)
+{
+	EXPECT_TRUE( var_ctor1.is_in_domain( 7 ) );
+	EXPECT_FALSE( var_ctor1.is_in_domain( 4 ) );
+	EXPECT_FALSE( var_ctor1.is_in_domain( 10 ) );
+	EXPECT_TRUE( var_ctor2.is_in_domain( 10 ) );
+	EXPECT_TRUE( var_ctor2.is_in_domain( 15 ) );
+	EXPECT_FALSE( var_ctor2.is_in_domain( 16 ) );
+	EXPECT_FALSE( var_ctor3.is_in_domain( -2 ) );
+}
+
 TEST_F(VariableTest, GetNames)
 {
 	EXPECT_EQ( var_ctor1.get_name(), "var_ctor1" );
@@ -1,8 +1,9 @@
 #include "knapsack_model_builder.hpp"
-#include "knapsack_capacity.hpp"
 #include "knapsack_alldiff.hpp"
 #include "knapsack_objective.hpp"
 
+#include <ghost/expressions/expression_templates.hpp>
+
 KSBuilder::KSBuilder()
 	: ModelBuilder()
 { }
@@ -14,7 +15,10 @@ void KSBuilder::declare_variables()
 
 void KSBuilder::declare_constraints()
 {
-	constraints.emplace_back( std::make_shared<KSCapacity>( variables, 15, std::vector<int>{12,2,1,1,4} ) );
+	// Capacity constraint, generated at compile time from an expression.
+	// KSCapacity (knapsack_capacity.hpp) is the same constraint written by hand.
+	using namespace ghost::expr;
+	constraints.emplace_back( make_constraint( sum( coefficients( {12,2,1,1,4} ) * vars( variables ) ) <= 15 ) );
 	constraints.emplace_back( std::make_shared<KSAllDiff>( variables ) );
 }
 